@@ -0,0 +1,31 @@
+// Copyright (c) Jared Taylor
+
+using UnrealBuildTool;
+
+public class GraspMass : ModuleRules
+{
+	public GraspMass(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"MassEntity",
+				"MassSpawner",
+				"Grasp",
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"MassCommon",
+			}
+			);
+	}
+}
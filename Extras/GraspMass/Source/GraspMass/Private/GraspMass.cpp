@@ -0,0 +1,17 @@
+// Copyright (c) Jared Taylor
+
+#include "GraspMass.h"
+
+#define LOCTEXT_NAMESPACE "FGraspMassModule"
+
+void FGraspMassModule::StartupModule()
+{
+}
+
+void FGraspMassModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FGraspMassModule, GraspMass)
@@ -0,0 +1,211 @@
+// Copyright (c) Jared Taylor
+
+#include "GraspMassScanProcessor.h"
+#include "GraspMassFragments.h"
+#include "GraspStatics.h"
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+#include "Engine/World.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspMassScanProcessor)
+
+namespace FGraspCVars
+{
+	static float MassScanInterval = 0.1f;
+	FAutoConsoleVariableRef CVarMassScanInterval(
+		TEXT("p.Grasp.Mass.ScanInterval"),
+		MassScanInterval,
+		TEXT("Time between Mass interactor scans, in seconds.\n")
+		TEXT("0: Scan every frame"),
+		ECVF_Default);
+}
+
+namespace GraspMass
+{
+	/** Graspables gathered for a single scan, stored as parallel arrays */
+	struct FGraspableSet
+	{
+		TArray<FMassEntityHandle> Handles;
+		TArray<FVector> Locations;
+		TArray<FVector> Forwards;
+		TArray<FGraspInteractParams> Params;
+		TArray<float> MaxReachSquared;
+
+		/** Graspable indices bucketed by 2D cell */
+		TMap<FIntPoint, TArray<int32>> Grid;
+		float CellSize = 1.f;
+
+		int32 Num() const { return Handles.Num(); }
+
+		FIntPoint GetCell(const FVector& Location) const
+		{
+			return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+		}
+
+		void Reset()
+		{
+			Handles.Reset();
+			Locations.Reset();
+			Forwards.Reset();
+			Params.Reset();
+			MaxReachSquared.Reset();
+			Grid.Reset();
+		}
+	};
+}
+
+UGraspMassScanProcessor::UGraspMassScanProcessor()
+{
+	ExecutionFlags = (int32)(EProcessorExecutionFlags::Server | EProcessorExecutionFlags::Standalone);
+	ProcessingPhase = EMassProcessingPhase::PostPhysics;
+	bAutoRegisterWithProcessingPhases = true;
+
+	GraspableQuery.RegisterWithProcessor(*this);
+	InteractorQuery.RegisterWithProcessor(*this);
+}
+
+#if UE_5_06_OR_LATER
+void UGraspMassScanProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+#else
+void UGraspMassScanProcessor::ConfigureQueries()
+#endif
+{
+	GraspableQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	GraspableQuery.AddRequirement<FGraspableFragment>(EMassFragmentAccess::ReadOnly);
+
+	InteractorQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	InteractorQuery.AddRequirement<FGraspInteractorFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+void UGraspMassScanProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspMassScanProcessor::Execute);
+
+	if (const UWorld* World = EntityManager.GetWorld())
+	{
+		const double TimeSeconds = World->GetTimeSeconds();
+		if (TimeSeconds - LastScanTime < FGraspCVars::MassScanInterval)
+		{
+			return;
+		}
+		LastScanTime = TimeSeconds;
+	}
+
+	GraspMass::FGraspableSet Graspables;
+	float MaxReach = 0.f;
+
+	// Gather every graspable into flat arrays
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UGraspMassScanProcessor::GatherGraspables);
+
+		GraspableQuery.ForEachEntityChunk(EntityManager, Context, [&Graspables, &MaxReach](FMassExecutionContext& ChunkContext)
+		{
+			const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+			const TConstArrayView<FGraspableFragment> GraspableFragments = ChunkContext.GetFragmentView<FGraspableFragment>();
+
+			const int32 NumEntities = ChunkContext.GetNumEntities();
+			for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
+			{
+				const FTransform& Transform = Transforms[EntityIndex].GetTransform();
+				const FGraspableFragment& Graspable = GraspableFragments[EntityIndex];
+				const float Reach = Graspable.GetMaxReach();
+				if (Reach <= 0.f)
+				{
+					continue;
+				}
+
+				Graspables.Handles.Add(ChunkContext.GetEntity(EntityIndex));
+				Graspables.Locations.Add(Transform.GetLocation());
+				Graspables.Forwards.Add(Transform.GetUnitAxis(EAxis::X));
+				Graspables.Params.Add(Graspable.Params);
+				Graspables.MaxReachSquared.Add(FMath::Square(Reach));
+				MaxReach = FMath::Max(MaxReach, Reach);
+			}
+		});
+	}
+
+	// Bucket by the largest reach so an interactor only needs to test its own and neighbouring cells
+	Graspables.CellSize = FMath::Max(MaxReach, 1.f);
+	for (int32 Index = 0; Index < Graspables.Num(); ++Index)
+	{
+		Graspables.Grid.FindOrAdd(Graspables.GetCell(Graspables.Locations[Index])).Add(Index);
+	}
+
+	// Test each interactor against nearby graspables
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspMassScanProcessor::ScanInteractors);
+
+	InteractorQuery.ForEachEntityChunk(EntityManager, Context, [&Graspables](FMassExecutionContext& ChunkContext)
+	{
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TArrayView<FGraspInteractorFragment> Interactors = ChunkContext.GetMutableFragmentView<FGraspInteractorFragment>();
+
+		const int32 NumEntities = ChunkContext.GetNumEntities();
+		for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
+		{
+			FGraspInteractorFragment& Interactor = Interactors[EntityIndex];
+			Interactor.Reachable.Reset();
+
+			if (Graspables.Num() == 0)
+			{
+				continue;
+			}
+
+			const FVector InteractorLocation = Transforms[EntityIndex].GetTransform().GetLocation();
+			const FIntPoint InteractorCell = Graspables.GetCell(InteractorLocation);
+
+			for (int32 CellY = -1; CellY <= 1; ++CellY)
+			{
+				for (int32 CellX = -1; CellX <= 1; ++CellX)
+				{
+					const TArray<int32>* Cell = Graspables.Grid.Find(InteractorCell + FIntPoint(CellX, CellY));
+					if (!Cell)
+					{
+						continue;
+					}
+
+					for (const int32 Index : *Cell)
+					{
+						// Cheap 2D reject before the full test, distance checks are 2D by default
+						if (FVector::DistSquared2D(InteractorLocation, Graspables.Locations[Index]) > Graspables.MaxReachSquared[Index])
+						{
+							continue;
+						}
+
+						float NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance;
+						const EGraspQueryResult QueryResult = UGraspStatics::CanInteractWithParams(InteractorLocation,
+							Graspables.Locations[Index], Graspables.Forwards[Index], Graspables.Params[Index],
+							NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance);
+
+						if (QueryResult == EGraspQueryResult::None)
+						{
+							continue;
+						}
+
+						FGraspMassReachable& Reachable = Interactor.Reachable.AddDefaulted_GetRef();
+						Reachable.Graspable = Graspables.Handles[Index];
+						Reachable.QueryResult = QueryResult;
+						Reachable.NormalizedDistance = NormalizedDistance;
+						Reachable.NormalizedHighlightDistance = NormalizedHighlightDistance;
+						Reachable.NormalizedAngleDiff = NormalizedAngleDiff;
+					}
+				}
+			}
+
+			// Interact before Highlight, then nearest first
+			Interactor.Reachable.Sort([](const FGraspMassReachable& A, const FGraspMassReachable& B)
+			{
+				if (A.QueryResult != B.QueryResult)
+				{
+					return A.QueryResult == EGraspQueryResult::Interact;
+				}
+				return A.QueryResult == EGraspQueryResult::Interact ?
+					A.NormalizedDistance < B.NormalizedDistance : A.NormalizedHighlightDistance < B.NormalizedHighlightDistance;
+			});
+
+			if (Interactor.Reachable.Num() > Interactor.MaxReachable)
+			{
+				Interactor.Reachable.SetNum(Interactor.MaxReachable);
+			}
+		}
+	});
+}
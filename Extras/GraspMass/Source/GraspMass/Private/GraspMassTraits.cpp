@@ -0,0 +1,28 @@
+// Copyright (c) Jared Taylor
+
+#include "GraspMassTraits.h"
+#include "GraspData.h"
+#include "GraspMassFragments.h"
+#include "MassCommonFragments.h"
+#include "MassEntityTemplateRegistry.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspMassTraits)
+
+void UGraspableTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	ensureMsgf(GraspData, TEXT("%s: GraspData is not set, graspable entities will use default range parameters"), *GetName());
+
+	BuildContext.RequireFragment<FTransformFragment>();
+
+	FGraspableFragment& Graspable = BuildContext.AddFragment_GetRef<FGraspableFragment>();
+	Graspable.Params = FGraspInteractParams::Make(GraspData);
+	Graspable.GraspData = GraspData;
+}
+
+void UGraspInteractorTrait::BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const
+{
+	BuildContext.RequireFragment<FTransformFragment>();
+
+	FGraspInteractorFragment& Interactor = BuildContext.AddFragment_GetRef<FGraspInteractorFragment>();
+	Interactor.MaxReachable = FMath::Max(1, MaxReachable);
+}
@@ -0,0 +1,14 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+class FGraspMassModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
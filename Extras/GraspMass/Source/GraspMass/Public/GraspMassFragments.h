@@ -0,0 +1,91 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraspTypes.h"
+#include "MassEntityTypes.h"
+#include "GraspMassFragments.generated.h"
+
+class UGraspData;
+
+/**
+ * A graspable that lives in Mass instead of on a component
+ * Location and forward come from the entity's FTransformFragment
+ */
+USTRUCT()
+struct GRASPMASS_API FGraspableFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Range parameters copied from GraspData when the entity was created */
+	UPROPERTY()
+	FGraspInteractParams Params;
+
+	/** The GraspData the params were copied from, for game thread lookups only */
+	UPROPERTY()
+	TWeakObjectPtr<const UGraspData> GraspData = nullptr;
+
+	/** Furthest distance an interactor can be from this graspable and still receive a result */
+	float GetMaxReach() const { return FMath::Max(Params.MaxGraspDistance, Params.MaxHighlightDistance); }
+};
+
+/**
+ * A graspable that an interactor can currently reach
+ */
+USTRUCT()
+struct GRASPMASS_API FGraspMassReachable
+{
+	GENERATED_BODY()
+
+	FGraspMassReachable()
+		: QueryResult(EGraspQueryResult::None)
+		, NormalizedDistance(0.f)
+		, NormalizedHighlightDistance(0.f)
+		, NormalizedAngleDiff(0.f)
+	{}
+
+	/** The graspable entity */
+	UPROPERTY()
+	FMassEntityHandle Graspable;
+
+	/** Highlight or Interact */
+	UPROPERTY()
+	EGraspQueryResult QueryResult;
+
+	/** Normalized distance between the interactor and the graspable, valid when QueryResult is Interact */
+	UPROPERTY()
+	float NormalizedDistance;
+
+	/** Normalized highlight distance between the interactor and the graspable, valid when QueryResult is Highlight */
+	UPROPERTY()
+	float NormalizedHighlightDistance;
+
+	/** Normalized angle difference between the interactor and the graspable, valid when QueryResult is Interact */
+	UPROPERTY()
+	float NormalizedAngleDiff;
+};
+
+/**
+ * An entity that scans for graspable entities
+ * Filled by UGraspMassScanProcessor, does not grant abilities; that remains the job of UGraspComponent
+ */
+USTRUCT()
+struct GRASPMASS_API FGraspInteractorFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Graspables that can currently be interacted with or highlighted, Interact first, then nearest first */
+	UPROPERTY()
+	TArray<FGraspMassReachable> Reachable;
+
+	/** Maximum number of graspables to keep in Reachable */
+	UPROPERTY()
+	int32 MaxReachable = 4;
+
+	/** @return The first graspable that can be interacted with, or nullptr if none */
+	const FGraspMassReachable* GetBestInteractable() const
+	{
+		return Reachable.Num() > 0 && Reachable[0].QueryResult == EGraspQueryResult::Interact ? &Reachable[0] : nullptr;
+	}
+};
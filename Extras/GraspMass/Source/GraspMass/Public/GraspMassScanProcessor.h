@@ -0,0 +1,45 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "System/GraspVersioning.h"
+#include "GraspMassScanProcessor.generated.h"
+
+/**
+ * Finds graspable entities that each interactor entity can reach
+ * Runs the same range, angle and height tests as UGraspStatics::CanInteractWith
+ *
+ * Graspables are first gathered into flat arrays and bucketed into a 2D grid sized by the largest reach,
+ * then each interactor chunk only tests the graspables in its neighbouring cells
+ *
+ * Results are written to FGraspInteractorFragment::Reachable; no abilities are granted,
+ * GAS remains reserved for player controllers via UGraspComponent
+ */
+UCLASS()
+class GRASPMASS_API UGraspMassScanProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UGraspMassScanProcessor();
+
+protected:
+#if UE_5_06_OR_LATER
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+#else
+	virtual void ConfigureQueries() override;
+#endif
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	/** Graspable entities */
+	FMassEntityQuery GraspableQuery;
+
+	/** Interactor entities */
+	FMassEntityQuery InteractorQuery;
+
+	/** World time of the last scan */
+	double LastScanTime = -DBL_MAX;
+};
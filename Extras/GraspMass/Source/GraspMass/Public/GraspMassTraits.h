@@ -0,0 +1,43 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTraitBase.h"
+#include "GraspMassTraits.generated.h"
+
+class UGraspData;
+
+/**
+ * Adds FGraspableFragment so interactor entities can find this entity
+ */
+UCLASS(meta=(DisplayName="Grasp Graspable"))
+class GRASPMASS_API UGraspableTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Range parameters are copied from this GraspData when the entity is created */
+	UPROPERTY(EditAnywhere, Category=Grasp)
+	TObjectPtr<const UGraspData> GraspData;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
+
+/**
+ * Adds FGraspInteractorFragment so this entity receives a list of reachable graspable entities
+ */
+UCLASS(meta=(DisplayName="Grasp Interactor"))
+class GRASPMASS_API UGraspInteractorTrait : public UMassEntityTraitBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Maximum number of reachable graspables to keep per entity */
+	UPROPERTY(EditAnywhere, Category=Grasp, meta=(ClampMin="1", UIMin="1"))
+	int32 MaxReachable = 4;
+
+protected:
+	virtual void BuildTemplate(FMassEntityTemplateBuildContext& BuildContext, const UWorld& World) const override;
+};
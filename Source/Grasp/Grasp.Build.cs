@@ -27,6 +27,7 @@ public class Grasp : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"AIModule",
+				"NavigationSystem",
 				"UMG",
 			}
 			);
@@ -0,0 +1,237 @@
+// Copyright (c) Jared Taylor
+
+
+#include "Filtering/GraspFilter_LineOfSight.h"
+
+#include "CollisionQueryParams.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "WorldCollision.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_LineOfSight)
+
+namespace GraspLineOfSight
+{
+	/** Async traces return within a frame or two, anything pending this long was ended while in flight */
+	static constexpr double PendingRequestTimeout = 2.0;
+}
+
+UGraspFilter_LineOfSight::UGraspFilter_LineOfSight(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{}
+
+void UGraspFilter_LineOfSight::Execute(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::Execute);
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Executing);
+
+	UWorld* World = GetSourceContextWorld(TargetingHandle);
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	const FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle);
+	if (!World || !SourceContext || !IsValid(SourceContext->SourceActor) || !Results || Results->TargetResults.Num() == 0)
+	{
+		SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+		return;
+	}
+
+	const AActor* SourceActor = SourceContext->SourceActor;
+	const double TimeSeconds = World->GetTimeSeconds();
+	PruneVisibilityCache(TimeSeconds);
+	PrunePendingRequests(TimeSeconds);
+
+	const FVector TraceStart = GetTraceStart(SourceActor);
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(GraspFilter_LineOfSight), bTraceComplex, SourceActor);
+	const bool bAsync = IsAsyncTargetingRequest(TargetingHandle);
+
+	TArray<TObjectKey<UPrimitiveComponent>> Occluded;
+	FGraspLineOfSightPending* Pending = nullptr;
+
+	for (const FTargetingDefaultResultData& ResultData : Results->TargetResults)
+	{
+		const UPrimitiveComponent* Target = ResultData.HitResult.GetComponent();
+		if (!Target)
+		{
+			continue;
+		}
+
+		const FGraspVisibilityCacheKey Key(TObjectKey<AActor>(SourceActor), TObjectKey<UPrimitiveComponent>(Target));
+
+		// Reuse the last result if the source hasn't moved
+		if (const FGraspVisibilityCacheEntry* Cached = FindCachedVisibility(Key, TraceStart, TimeSeconds))
+		{
+			if (!Cached->bVisible)
+			{
+				Occluded.Add(Key.Value);
+			}
+			continue;
+		}
+
+		const FVector TraceEnd = Target->GetComponentLocation();
+		if (bAsync)
+		{
+			// Only one request per handle can execute at a time, so this replaces any stale entry
+			if (!Pending)
+			{
+				Pending = &PendingRequests.Add(TargetingHandle);
+				Pending->StartTime = TimeSeconds;
+				Pending->Serial = ++LastPendingSerial;
+			}
+			Pending->NumOutstanding++;
+
+			const FTraceDelegate Delegate = FTraceDelegate::CreateUObject(this,
+				&ThisClass::HandleAsyncTraceComplete, TargetingHandle, Pending->Serial, Key, TraceStart);
+			World->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, TraceChannel, Params,
+				FCollisionResponseParams::DefaultResponseParam, &Delegate);
+		}
+		else
+		{
+			FHitResult Hit;
+			const bool bHit = World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, TraceChannel, Params);
+			const bool bVisible = IsTargetVisible(Target, bHit ? &Hit : nullptr);
+
+			VisibilityCache.Add(Key, { TraceStart, TimeSeconds, bVisible });
+			if (!bVisible)
+			{
+				Occluded.Add(Key.Value);
+			}
+		}
+	}
+
+	// Completes when the last async trace returns
+	if (Pending)
+	{
+		Pending->Occluded.Append(Occluded);
+		return;
+	}
+
+	RemoveOccludedTargets(TargetingHandle, Occluded);
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+}
+
+FVector UGraspFilter_LineOfSight::GetTraceStart(const AActor* SourceActor) const
+{
+	const APawn* Pawn = Cast<APawn>(SourceActor);
+	const FVector Location = Pawn ? Pawn->GetPawnViewLocation() : SourceActor->GetActorLocation();
+	return Location + SourceActor->GetActorQuat().RotateVector(SourceOffset);
+}
+
+bool UGraspFilter_LineOfSight::IsTargetVisible(const UPrimitiveComponent* Target, const FHitResult* BlockingHit)
+{
+	if (!BlockingHit || !BlockingHit->bBlockingHit)
+	{
+		return true;
+	}
+
+	// Hitting any part of the graspable's owner counts as seeing it
+	const UPrimitiveComponent* HitComponent = BlockingHit->GetComponent();
+	return HitComponent == Target || (HitComponent && HitComponent->GetOwner() == Target->GetOwner());
+}
+
+const UGraspFilter_LineOfSight::FGraspVisibilityCacheEntry* UGraspFilter_LineOfSight::FindCachedVisibility(
+	const FGraspVisibilityCacheKey& Key, const FVector& SourceLocation, double TimeSeconds) const
+{
+	if (VisibilityCacheDuration <= 0.f)
+	{
+		return nullptr;
+	}
+
+	const FGraspVisibilityCacheEntry* Entry = VisibilityCache.Find(Key);
+	if (!Entry || TimeSeconds - Entry->Time > VisibilityCacheDuration)
+	{
+		return nullptr;
+	}
+
+	if (FVector::DistSquared(Entry->SourceLocation, SourceLocation) > FMath::Square(VisibilityCacheTolerance))
+	{
+		return nullptr;
+	}
+
+	return Entry;
+}
+
+void UGraspFilter_LineOfSight::PruneVisibilityCache(double TimeSeconds) const
+{
+	if (TimeSeconds - LastPruneTime < VisibilityCacheDuration)
+	{
+		return;
+	}
+	LastPruneTime = TimeSeconds;
+
+	for (auto It = VisibilityCache.CreateIterator(); It; ++It)
+	{
+		if (TimeSeconds - It->Value.Time > VisibilityCacheDuration)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGraspFilter_LineOfSight::PrunePendingRequests(double TimeSeconds) const
+{
+	for (auto It = PendingRequests.CreateIterator(); It; ++It)
+	{
+		// Released handles have no task data left
+		if (!FTargetingAsyncTaskData::Find(It->Key) ||
+			TimeSeconds - It->Value.StartTime > GraspLineOfSight::PendingRequestTimeout)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGraspFilter_LineOfSight::HandleAsyncTraceComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum,
+	FTargetingRequestHandle TargetingHandle, uint32 Serial, FGraspVisibilityCacheKey Key, FVector SourceLocation) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::HandleAsyncTraceComplete);
+
+	const UPrimitiveComponent* Target = Key.Value.ResolveObjectPtr();
+	const FHitResult* BlockingHit = InTraceDatum.OutHits.Num() > 0 ? &InTraceDatum.OutHits[0] : nullptr;
+	const bool bVisible = Target && IsTargetVisible(Target, BlockingHit);
+
+	if (const UWorld* World = InTraceDatum.PhysWorld.Get())
+	{
+		VisibilityCache.Add(Key, { SourceLocation, World->GetTimeSeconds(), bVisible });
+	}
+
+	// Request was replaced or ended, pooled handles can be executing again by the time a trace from an earlier run returns
+	FGraspLineOfSightPending* Pending = PendingRequests.Find(TargetingHandle);
+	if (!Pending || Pending->Serial != Serial)
+	{
+		return;
+	}
+
+	if (!bVisible)
+	{
+		Pending->Occluded.Add(Key.Value);
+	}
+
+	if (--Pending->NumOutstanding > 0)
+	{
+		return;
+	}
+
+	const TArray<TObjectKey<UPrimitiveComponent>> Occluded = MoveTemp(Pending->Occluded);
+	PendingRequests.Remove(TargetingHandle);
+
+	RemoveOccludedTargets(TargetingHandle, Occluded);
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+}
+
+void UGraspFilter_LineOfSight::RemoveOccludedTargets(const FTargetingRequestHandle& TargetingHandle,
+	const TArray<TObjectKey<UPrimitiveComponent>>& Occluded)
+{
+	if (Occluded.Num() == 0)
+	{
+		return;
+	}
+
+	if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle))
+	{
+		Results->TargetResults.RemoveAll([&Occluded](const FTargetingDefaultResultData& ResultData)
+		{
+			return Occluded.Contains(TObjectKey<UPrimitiveComponent>(ResultData.HitResult.GetComponent()));
+		});
+	}
+}
@@ -6,15 +6,21 @@
 #include "AbilitySystemComponent.h"
 #include "GraspableComponent.h"
 #include "GraspData.h"
+#include "GraspStatics.h"
+#include "GraspSubsystem.h"
 #include "TargetingSystem/TargetingSubsystem.h"
+#include "TargetingSystem/TargetingPreset.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
+#include "TimerManager.h"
 #include "Misc/UObjectToken.h"
+#include "Misc/MemStack.h"
 #include "Components/PrimitiveComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Logging/MessageLog.h"
+#include "UObject/UObjectGlobals.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspComponent)
 
@@ -31,12 +37,48 @@ namespace FGraspCVars
 		TEXT("Enable debug drawing for Grasp ability give and clear."),
 		ECVF_Default);
 #endif
+
+	static bool bReuseTargetingHandles = true;
+	FAutoConsoleVariableRef CVarReuseTargetingHandles(
+		TEXT("p.Grasp.Scan.ReuseTargetingHandles"),
+		bReuseTargetingHandles,
+		TEXT("If true, Grasp keeps one targeting request handle per preset and reuses it for each scan.\n")
+		TEXT("If false, every scan makes a new handle that is released on completion."),
+		ECVF_Default);
+}
+
+namespace GraspMirror
+{
+	/** States kept by each side, the server only makes a new one when its granted set changes */
+	static constexpr int32 MaxHistory = 8;
+
+	/** Sequences wrap, skipping 0 which is reserved for the empty set */
+	static uint16 NextSequence(uint16 Sequence)
+	{
+		return Sequence == MAX_uint16 ? 1 : Sequence + 1;
+	}
+
+	/** @return True if A is more recent than B, anything is more recent than the empty set */
+	static bool IsNewerSequence(uint16 A, uint16 B)
+	{
+		return B == 0 || (A != 0 && static_cast<int16>(A - B) > 0);
+	}
+
+	template<typename TState>
+	static void AddToHistory(TArray<TState>& History, TState&& State)
+	{
+		if (History.Num() >= MaxHistory)
+		{
+			History.RemoveAt(0, EAllowShrinking::No);
+		}
+		History.Add(MoveTemp(State));
+	}
 }
 
 UGraspComponent::UGraspComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	// No ticking or replication, ever
+	// No ticking, and no replication unless the client mirror is enabled
 	PrimaryComponentTick.bCanEverTick = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 	PrimaryComponentTick.bAllowTickOnDedicatedServer = false;
@@ -114,6 +156,33 @@ void UGraspComponent::InitializeGrasp(UAbilitySystemComponent* InAbilitySystemCo
 
 			// Bind the pawn changed event if required
 			UpdatePawnChangedBinding();
+
+			// The client mirror receives corrections via RPC
+			if (bEnableClientMirror)
+			{
+				SetIsReplicated(true);
+			}
+
+			// Release ability locks when graspables are destroyed instead of checking for them each scan
+			UGraspSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UGraspSubsystem>() : nullptr;
+			if (Subsystem && !GraspableUnregisteredHandle.IsValid())
+			{
+				GraspableUnregisteredHandle = Subsystem->OnGraspableUnregistered.AddUObject(this,
+					&ThisClass::OnGraspableUnregistered);
+			}
+
+			// Graspables that don't register with the subsystem are caught once they are garbage collected
+			if (!PostGarbageCollectHandle.IsValid())
+			{
+				PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this,
+					&ThisClass::OnPostGarbageCollect);
+			}
+		}
+
+		// Drive UI and highlighting from a local scan on the owning client
+		if (bEnableLocalScan && Controller && Controller->IsLocalController())
+		{
+			StartLocalScan();
 		}
 	}
 }
@@ -148,6 +217,122 @@ const FGraspAbilityData* UGraspComponent::GetGraspAbilityData(const TSubclassOf<
 	return AbilityData.Find(Ability);
 }
 
+void UGraspComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GraspableUnregisteredHandle.IsValid())
+	{
+		if (UGraspSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UGraspSubsystem>() : nullptr)
+		{
+			Subsystem->OnGraspableUnregistered.Remove(GraspableUnregisteredHandle);
+		}
+		GraspableUnregisteredHandle.Reset();
+	}
+
+	if (PostGarbageCollectHandle.IsValid())
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+	}
+
+	StopLocalScan();
+	EndAllTargetingRequests(false);
+	ReleasePooledTargetingRequests(FGameplayTag::EmptyTag);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FTargetingRequestHandle UGraspComponent::AcquireTargetingRequest(UTargetingSubsystem* TargetSubsystem,
+	const FGameplayTag& PresetTag, const UTargetingPreset* Preset, AActor* TargetingSource)
+{
+	return AcquirePooledTargetingRequest(PooledTargetingRequests, TargetingRequests, TargetSubsystem, PresetTag, Preset,
+		TargetingSource);
+}
+
+void UGraspComponent::ReleasePooledTargetingRequests(const FGameplayTag& PresetTag)
+{
+	ReleasePooledTargetingRequests(PooledTargetingRequests, TargetingRequests, PresetTag);
+}
+
+FTargetingRequestHandle UGraspComponent::AcquirePooledTargetingRequest(TMap<FGameplayTag, FGraspPooledTargetingRequest>& Pool,
+	const TMap<FGameplayTag, FTargetingRequestHandle>& InProgressRequests, UTargetingSubsystem* TargetSubsystem,
+	const FGameplayTag& PresetTag, const UTargetingPreset* Preset, AActor* TargetingSource)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::AcquireTargetingRequest);
+
+	if (!FGraspCVars::bReuseTargetingHandles)
+	{
+		ReleasePooledTargetingRequests(Pool, InProgressRequests, PresetTag);
+
+		const FTargetingRequestHandle Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
+		FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Handle);
+		AsyncTaskData.bReleaseOnCompletion = true;
+		return Handle;
+	}
+
+	FGraspPooledTargetingRequest& Pooled = Pool.FindOrAdd(PresetTag);
+	if (Pooled.Handle.IsValid() && Pooled.Preset.Get() == Preset)
+	{
+		// Reset the handle in place, the results keep their capacity
+		FTargetingSourceContext& SourceContext = FTargetingSourceContext::FindOrAdd(Pooled.Handle);
+		SourceContext = FTargetingSourceContext{TargetingSource};
+
+		if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(Pooled.Handle))
+		{
+			Results->TargetResults.Reset();
+		}
+
+		// Clear any task state left over from the last request
+		FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Pooled.Handle);
+		AsyncTaskData = FTargetingAsyncTaskData();
+		AsyncTaskData.bReleaseOnCompletion = false;
+		return Pooled.Handle;
+	}
+
+	// Preset changed, or nothing pooled yet
+	if (Pooled.Handle.IsValid())
+	{
+		UTargetingSubsystem::ReleaseTargetRequestHandle(Pooled.Handle);
+	}
+
+	Pooled.Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
+	Pooled.Preset = Preset;
+
+	FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Pooled.Handle);
+	AsyncTaskData.bReleaseOnCompletion = false;
+	return Pooled.Handle;
+}
+
+void UGraspComponent::ReleasePooledTargetingRequests(TMap<FGameplayTag, FGraspPooledTargetingRequest>& Pool,
+	const TMap<FGameplayTag, FTargetingRequestHandle>& InProgressRequests, const FGameplayTag& PresetTag)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::ReleasePooledTargetingRequests);
+
+	for (auto It = Pool.CreateIterator(); It; ++It)
+	{
+		// If no tag, release them all
+		if (PresetTag.IsValid() && It->Key != PresetTag)
+		{
+			continue;
+		}
+
+		FGraspPooledTargetingRequest& Pooled = It->Value;
+		if (Pooled.Handle.IsValid())
+		{
+			// In-progress handles are released by the TargetingSubsystem when they complete
+			const FTargetingRequestHandle* InProgress = InProgressRequests.Find(It->Key);
+			if (InProgress && *InProgress == Pooled.Handle)
+			{
+				FTargetingAsyncTaskData::FindOrAdd(Pooled.Handle).bReleaseOnCompletion = true;
+			}
+			else
+			{
+				UTargetingSubsystem::ReleaseTargetRequestHandle(Pooled.Handle);
+			}
+		}
+		It.RemoveCurrent();
+	}
+}
+
 void UGraspComponent::UpdatePawnChangedBinding()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::UpdatePawnChangedBinding);
@@ -202,6 +387,7 @@ void UGraspComponent::UpdateTargetingPresets()
 		if (!CurrentTargetingPresets.Contains(Preset.Key))
 		{
 			EndTargetingRequests(Preset.Key);
+			ReleasePooledTargetingRequests(Preset.Key);
 		}
 	}
 }
@@ -247,8 +433,11 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 	}
 	
 	// Update our current focus results
-	TArray<FGraspScanResult> LastScanResults = CurrentScanResults;
-	CurrentScanResults = Results;
+	Swap(LastScanResults, CurrentScanResults);
+	CurrentScanResults.Reset();
+	CurrentScanResults.Append(Results);
+	PendingMirrorGranted.Reset();
+	PendingAbilityChanges.Reset();
 	
 	// Grant any new abilities that aren't pre-granted
 	for (const FGraspScanResult& Result : Results)
@@ -259,6 +448,9 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 		const UPrimitiveComponent* Component = Result.Graspable.IsValid() ? Result.Graspable.Get() : nullptr;
 		const IGraspableComponent* Graspable = CastChecked<IGraspableComponent>(Component);
 
+		// Track whether any of the graspable's abilities are granted, for the client mirror
+		bool bGranted = false;
+
 		const int32 NumData = Graspable->GetNumGraspData();
 		for (int32 DataIndex = 0; DataIndex < NumData; DataIndex++)
 		{
@@ -284,12 +476,14 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 #if UE_ENABLE_DEBUG_DRAWING || ENABLE_VISUAL_LOG
 				DrawDebugGrantAbilityLine(Component, FColor::Purple);
 #endif
+				bGranted = true;
 				continue;
 			}
 
 			// This ability is already granted
-			if (Data.Handle.IsValid())
+			if (Data.Handle.IsValid() && !Data.bParked)
 			{
+				bGranted = true;
 				if (!Data.Graspables.Contains(Component))
 				{
 #if UE_ENABLE_DEBUG_DRAWING || ENABLE_VISUAL_LOG
@@ -330,6 +524,33 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 				continue;
 			}
 
+			// Reuse the parked ability instead of granting it again
+			if (Data.bParked)
+			{
+				UE_LOG(LogGrasp, Verbose,
+					TEXT("%s GraspComponent::GraspTargetsReady: Unparking ability %s for %s"),
+					*GetRoleString(), *Ability->GetName(), *Result.Graspable->GetName());
+
+#if UE_ENABLE_DEBUG_DRAWING || ENABLE_VISUAL_LOG
+				DrawDebugGrantAbilityBox(Component, "Unpark", GetNameSafe(Ability), FColor::Green);
+#endif
+
+				UnparkGraspAbility(Ability, Data);
+				Data.Graspables.Add(Result.Graspable.Get());
+				bGranted = true;
+
+				// Extension point
+				if (bBatchAbilityNotifications)
+				{
+					PendingAbilityChanges.Emplace(Ability, Component, GraspDataEntry, Data.Handle, true);
+				}
+				else
+				{
+					PostGiveGraspAbility(Ability, Component, GraspDataEntry, Data);
+				}
+				continue;
+			}
+
 			UE_LOG(LogGrasp, Verbose,
 				TEXT("%s GraspComponent::GraspTargetsReady: Granting ability %s to %s"),
 				*GetRoleString(), *Ability->GetName(), *Result.Graspable->GetName());
@@ -349,11 +570,24 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 				Data.Spec = Spec;
 				Data.Ability = Ability;
 				Data.Graspables.Add(Result.Graspable.Get());
+				bGranted = true;
 
 				// Extension point
-				PostGiveGraspAbility(Ability, Component, GraspDataEntry, Data);
+				if (bBatchAbilityNotifications)
+				{
+					PendingAbilityChanges.Emplace(Ability, Component, GraspDataEntry, Handle, true);
+				}
+				else
+				{
+					PostGiveGraspAbility(Ability, Component, GraspDataEntry, Data);
+				}
 			}
 		}
+
+		if (bGranted && bEnableClientMirror)
+		{
+			PendingMirrorGranted.Add(Component);
+		}
 	}
 	
 	// Remove any abilities granted for the old results unless they are still valid
@@ -415,14 +649,8 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 				continue;
 			}
 
-			// Clear any weak null ability locks
-			Data->LockedGraspables.RemoveAll([](const TWeakObjectPtr<const UPrimitiveComponent>& WeakGraspable)
-			{
-				return !WeakGraspable.IsValid();
-			});
-
 			// If ability lock is in place, skip it
-			if (Data->LockedGraspables.Num() > 0)
+			if (IsAbilityLocked(*Data))
 			{
 				continue;
 			}
@@ -460,9 +688,25 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 						TEXT("%s GraspComponent::GraspTargetsReady: Removing ability %s"),
 						*GetRoleString(), *Ability->GetName());
 
-					PreClearGraspAbility(Ability, GraspData, *Data);
-					ASC->ClearAbility(Data->Handle);
-					AbilityData.Remove(Ability);
+					// Extension point
+					if (bBatchAbilityNotifications)
+					{
+						PendingAbilityChanges.Emplace(Ability, Component, GraspData, Data->Handle, false);
+					}
+					else
+					{
+						PreClearGraspAbility(Ability, GraspData, *Data);
+					}
+
+					if (MaxParkedGraspAbilities > 0)
+					{
+						ParkGraspAbility(Ability, *Data);
+					}
+					else
+					{
+						ASC->ClearAbility(Data->Handle);
+						AbilityData.Remove(Ability);
+					}
 				}
 #if UE_ENABLE_DEBUG_DRAWING || ENABLE_VISUAL_LOG
 				else
@@ -473,6 +717,18 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 			}
 		}
 	}
+
+	// Notify everything this scan changed at once
+	if (PendingAbilityChanges.Num() > 0)
+	{
+		GraspAbilitiesChanged(PendingAbilityChanges);
+		PendingAbilityChanges.Reset();
+	}
+
+	if (bEnableClientMirror)
+	{
+		SendMirrorCorrections();
+	}
 }
 
 void UGraspComponent::PostGiveGraspAbility_Implementation(TSubclassOf<UGameplayAbility> InAbility,
@@ -502,6 +758,14 @@ void UGraspComponent::PreClearGraspAbility_Implementation(TSubclassOf<UGameplayA
 	}
 }
 
+void UGraspComponent::GraspAbilitiesChanged_Implementation(const TArray<FGraspAbilityChange>& Changes)
+{
+	if (OnGraspAbilitiesChanged.IsBound())
+	{
+		OnGraspAbilitiesChanged.Broadcast(this, Changes);
+	}
+}
+
 void UGraspComponent::PreTryActivateGraspAbility(const AActor* SourceActor, UPrimitiveComponent* GraspableComponent,
 	EGraspAbilityComponentSource Source, FGameplayAbilitySpec* InSpec)
 {
@@ -552,13 +816,23 @@ void UGraspComponent::EndTargetingRequests(const FGameplayTag& PresetTag, bool b
 	if (UTargetingSubsystem* TargetSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UTargetingSubsystem>())
 	{
 		// Oddly, there is no 'end all requests' option, and the handles are not accessible, so we track the handles ourselves
-		TArray<FGameplayTag> RemovedRequests;
+		FMemMark Mark(FMemStack::Get());
+		TArray<FGameplayTag, TMemStackAllocator<>> RemovedRequests;
 		for (auto& Request : TargetingRequests)
 		{
 			// If no tag, remove them all
 			if (!PresetTag.IsValid() || Request.Key == PresetTag)
 			{
 				RemovedRequests.Add(Request.Key);
+
+				// Pooled handles are abandoned once ended, let the TargetingSubsystem release them
+				const FGraspPooledTargetingRequest* Pooled = PooledTargetingRequests.Find(Request.Key);
+				if (Pooled && Pooled->Handle == Request.Value)
+				{
+					PooledTargetingRequests.Remove(Request.Key);
+					FTargetingAsyncTaskData::FindOrAdd(Request.Value).bReleaseOnCompletion = true;
+				}
+
 				TargetSubsystem->RemoveAsyncTargetingRequestWithHandle(Request.Value);
 			}
 		}
@@ -585,6 +859,422 @@ void UGraspComponent::EndTargetingRequests(const FGameplayTag& PresetTag, bool b
 	}
 }
 
+void UGraspComponent::StartLocalScan()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::StartLocalScan);
+
+	if (!IsValid(GetWorld()) || !Controller || !Controller->IsLocalController())
+	{
+		return;
+	}
+
+	CurrentLocalScanPresets = LocalScanTargetingPresets.Num() > 0 ? LocalScanTargetingPresets :
+		ObjectPtrWrap(GetTargetingPresets());
+
+	GetWorld()->GetTimerManager().SetTimer(LocalScanTimer, this, &ThisClass::RequestLocalScan,
+		FMath::Max(0.01f, LocalScanInterval), true, 0.f);
+}
+
+void UGraspComponent::StopLocalScan()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::StopLocalScan);
+
+	if (IsValid(GetWorld()))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(LocalScanTimer);
+	}
+
+	EndLocalTargetingRequests();
+	ReleasePooledTargetingRequests(PooledLocalTargetingRequests, LocalTargetingRequests, FGameplayTag::EmptyTag);
+	LocalScanResults.Reset();
+	PendingLocalScanResults.Reset();
+	CurrentLocalScanPresets.Reset();
+	MirrorPredictedGranted.Reset();
+	PendingMirrorPredictedGranted.Reset();
+}
+
+bool UGraspComponent::IsLocalScanActive() const
+{
+	return IsValid(GetWorld()) && GetWorld()->GetTimerManager().IsTimerActive(LocalScanTimer);
+}
+
+void UGraspComponent::RequestLocalScan()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::RequestLocalScan);
+
+	// Previous scan has not completed, skip this one rather than stacking requests
+	if (LocalTargetingRequests.Num() > 0)
+	{
+		return;
+	}
+
+	if (!IsValid(GetWorld()) || !IsValid(GetWorld()->GetGameInstance()))
+	{
+		return;
+	}
+
+	UTargetingSubsystem* TargetSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UTargetingSubsystem>();
+	AActor* TargetingSource = GetTargetingSource();
+	if (!TargetSubsystem || !TargetingSource)
+	{
+		return;
+	}
+
+	PendingLocalScanResults.Reset();
+	PendingMirrorPredictedGranted.Reset();
+
+	for (const auto& Entry : CurrentLocalScanPresets)
+	{
+		const FGameplayTag& Tag = Entry.Key;
+		const UTargetingPreset* Preset = Entry.Value;
+
+		if (!Preset || !Preset->GetTargetingTaskSet() || Preset->GetTargetingTaskSet()->Tasks.IsEmpty())
+		{
+			continue;
+		}
+
+		const FTargetingRequestHandle Handle = AcquirePooledTargetingRequest(PooledLocalTargetingRequests,
+			LocalTargetingRequests, TargetSubsystem, Tag, Preset, TargetingSource);
+		LocalTargetingRequests.Add(Tag, Handle);
+
+		TargetSubsystem->StartAsyncTargetingRequestWithHandle(Handle,
+			FTargetingRequestDelegate::CreateUObject(this, &ThisClass::OnLocalScanComplete, Tag));
+	}
+}
+
+void UGraspComponent::OnLocalScanComplete(FTargetingRequestHandle TargetingHandle, FGameplayTag ScanTag)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::OnLocalScanComplete);
+
+	const AActor* Interactor = GetTargetingSource();
+	if (Interactor && TargetingHandle.IsValid())
+	{
+		if (const FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle))
+		{
+			for (const FTargetingDefaultResultData& ResultData : Results->TargetResults)
+			{
+				const FHitResult& Hit = ResultData.HitResult;
+				UPrimitiveComponent* Component = Hit.GetComponent();
+				const IGraspableComponent* Graspable = Cast<IGraspableComponent>(Component);
+				if (!Graspable || !Graspable->GetGraspData())
+				{
+					continue;
+				}
+
+				// Targeting output the GraspAbilityRadius as Distance
+				const FVector Location = Component->GetComponentLocation();
+				const float GraspAbilityRadius = Hit.Distance;
+				const float ScanDistance = Graspable->GetGraspData()->bGrantAbilityDistance2D ?
+					FVector::Dist2D(Location, Hit.TraceStart) : FVector::Dist(Location, Hit.TraceStart);
+				const float NormalizedScanDistance = GraspAbilityRadius > 0.f ? ScanDistance / GraspAbilityRadius : 0.f;
+
+				// Run the server's grant logic locally instead of waiting for ability specs to replicate
+				if (bEnableClientMirror && PredictGraspableAbilityGranted(Component, NormalizedScanDistance))
+				{
+					// Keep the time first predicted so a prediction the server never confirms times out
+					const TObjectKey<UPrimitiveComponent> Key(Component);
+					const float* PredictedTime = MirrorPredictedGranted.Find(Key);
+					PendingMirrorPredictedGranted.Add(Key, PredictedTime ? *PredictedTime : GetWorld()->GetTimeSeconds());
+				}
+
+				const int32 NumData = Graspable->GetNumGraspData();
+				for (int32 DataIndex = 0; DataIndex < NumData; DataIndex++)
+				{
+					FGraspLocalScanResult Result;
+					Result.QueryResult = UGraspStatics::CanInteractWith(Interactor, Component, Result.NormalizedAngleDiff,
+						Result.NormalizedDistance, Result.NormalizedHighlightDistance, DataIndex);
+
+					if (Result.QueryResult == EGraspQueryResult::None)
+					{
+						continue;
+					}
+
+					Result.ScanTag = ScanTag;
+					Result.Graspable = Component;
+					Result.GraspDataIndex = DataIndex;
+					Result.NormalizedScanDistance = NormalizedScanDistance;
+					PendingLocalScanResults.Add(Result);
+				}
+			}
+		}
+	}
+
+	LocalTargetingRequests.Remove(ScanTag);
+
+	// Wait for the remaining presets
+	if (LocalTargetingRequests.Num() > 0)
+	{
+		return;
+	}
+
+	// Interactable first, then nearest, using the highlight distance for highlight results
+	PendingLocalScanResults.Sort([](const FGraspLocalScanResult& A, const FGraspLocalScanResult& B)
+	{
+		if (A.QueryResult != B.QueryResult)
+		{
+			return A.QueryResult > B.QueryResult;
+		}
+		return A.QueryResult == EGraspQueryResult::Interact ?
+			A.NormalizedDistance < B.NormalizedDistance : A.NormalizedHighlightDistance < B.NormalizedHighlightDistance;
+	});
+
+	Swap(LocalScanResults, PendingLocalScanResults);
+	PendingLocalScanResults.Reset();
+
+	if (bEnableClientMirror)
+	{
+		Swap(MirrorPredictedGranted, PendingMirrorPredictedGranted);
+		PendingMirrorPredictedGranted.Reset();
+
+		UpdateLocalScanGrantedState();
+	}
+
+	OnLocalScanUpdated.Broadcast(this, LocalScanResults);
+}
+
+void UGraspComponent::EndLocalTargetingRequests()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::EndLocalTargetingRequests);
+
+	if (LocalTargetingRequests.Num() > 0 && IsValid(GetWorld()) && IsValid(GetWorld()->GetGameInstance()))
+	{
+		if (UTargetingSubsystem* TargetSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UTargetingSubsystem>())
+		{
+			for (auto& Request : LocalTargetingRequests)
+			{
+				TargetSubsystem->RemoveAsyncTargetingRequestWithHandle(Request.Value);
+			}
+		}
+	}
+	LocalTargetingRequests.Reset();
+}
+
+bool UGraspComponent::IsGraspableAbilityGranted(const UPrimitiveComponent* GraspableComponent) const
+{
+	if (!GraspableComponent)
+	{
+		return false;
+	}
+
+	// Authority knows what it granted
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		return MirrorGranted.Contains(GraspableComponent);
+	}
+
+	// The server's granted set is authoritative
+	if (MirrorHistory.Num() > 0 && MirrorHistory.Last().Granted.Contains(GraspableComponent))
+	{
+		return true;
+	}
+
+	// Trust the prediction until the server has had time to grant it
+	const float* PredictedTime = MirrorPredictedGranted.Find(TObjectKey<UPrimitiveComponent>(GraspableComponent));
+	return PredictedTime && GetWorld() && GetWorld()->TimeSince(*PredictedTime) <= MirrorPredictionTimeout;
+}
+
+bool UGraspComponent::PredictGraspableAbilityGranted(const UPrimitiveComponent* GraspableComponent,
+	float NormalizedScanDistance) const
+{
+	// Mirrors the grant logic in GraspTargetsReady()
+	const IGraspableComponent* Graspable = Cast<IGraspableComponent>(GraspableComponent);
+	if (!Graspable)
+	{
+		return false;
+	}
+
+	const int32 NumData = Graspable->GetNumGraspData();
+	for (int32 DataIndex = 0; DataIndex < NumData; DataIndex++)
+	{
+		const UGraspData* GraspDataEntry = Graspable->GetGraspData(DataIndex);
+		if (!GraspDataEntry || !GraspDataEntry->GetGraspAbility())
+		{
+			continue;
+		}
+
+		// Common abilities, abilities already granted for another graspable, or within the grant distance
+		const TSubclassOf<UGameplayAbility> Ability = GraspDataEntry->GetGraspAbility();
+		if (CommonGraspAbilities.Contains(Ability) || HasUnparkedGraspAbility(Ability) ||
+			NormalizedScanDistance <= GraspDataEntry->NormalizedGrantAbilityDistance)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UGraspComponent::HasUnparkedGraspAbility(TSubclassOf<UGameplayAbility> InAbility) const
+{
+	if (const FGraspAbilityData* Data = AbilityData.Find(InAbility))
+	{
+		return Data->Handle.IsValid() && !Data->bParked;
+	}
+
+	// Clients only have the replicated spec
+	const FGameplayAbilitySpec* Spec = InAbility && GetASC() ? GetASC()->FindAbilitySpecFromClass(InAbility) : nullptr;
+	return Spec && Spec->SourceObject.Get() == this && !Spec->GetDynamicSpecSourceTags().HasTagExact(FGraspTags::Grasp_Ability_Parked);
+}
+
+void UGraspComponent::SendMirrorCorrections()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::SendMirrorCorrections);
+
+	// Anything newly granted or no longer granted
+	bool bChanged = false;
+	for (const TWeakObjectPtr<const UPrimitiveComponent>& Graspable : PendingMirrorGranted)
+	{
+		if (!MirrorGranted.Contains(Graspable))
+		{
+			bChanged = true;
+			break;
+		}
+	}
+	for (int32 i = 0; !bChanged && i < MirrorGranted.Num(); i++)
+	{
+		bChanged = !PendingMirrorGranted.Contains(MirrorGranted[i]);
+	}
+
+	Swap(MirrorGranted, PendingMirrorGranted);
+	PendingMirrorGranted.Reset();
+
+	// Local controllers share our state, only remote clients need corrections
+	if (!Controller || Controller->IsLocalController())
+	{
+		return;
+	}
+
+	// Each change is a new state the client can acknowledge
+	if (bChanged)
+	{
+		MirrorSequence = GraspMirror::NextSequence(MirrorSequence);
+		GraspMirror::AddToHistory(MirrorHistory, FGraspMirrorState{ MirrorSequence, MirrorGranted });
+	}
+
+	// Nothing to send once the client holds our current state
+	if (MirrorBaseline.Sequence == MirrorSequence)
+	{
+		return;
+	}
+
+	// Send only what differs from the acknowledged state, resent each scan until the client acknowledges it
+	FGraspMirrorCorrections Corrections;
+	Corrections.Sequence = MirrorSequence;
+	Corrections.BaselineSequence = MirrorBaseline.Sequence;
+	for (const TWeakObjectPtr<const UPrimitiveComponent>& Graspable : MirrorGranted)
+	{
+		if (Graspable.IsValid() && !MirrorBaseline.Granted.Contains(Graspable))
+		{
+			Corrections.Add(Graspable.Get(), true);
+		}
+	}
+	for (const TWeakObjectPtr<const UPrimitiveComponent>& Graspable : MirrorBaseline.Granted)
+	{
+		if (Graspable.IsValid() && !MirrorGranted.Contains(Graspable))
+		{
+			Corrections.Add(Graspable.Get(), false);
+		}
+	}
+	ClientReceiveMirrorCorrections(Corrections);
+}
+
+void UGraspComponent::ClientReceiveMirrorCorrections_Implementation(const FGraspMirrorCorrections& Corrections)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::ClientReceiveMirrorCorrections);
+
+	// Corrections are unreliable, ignore any that arrive out of order or were resent before our acknowledgement arrived
+	const uint16 CurrentSequence = MirrorHistory.Num() > 0 ? MirrorHistory.Last().Sequence : 0;
+	if (!GraspMirror::IsNewerSequence(Corrections.Sequence, CurrentSequence))
+	{
+		if (Corrections.Sequence == CurrentSequence)
+		{
+			ServerAckMirrorCorrections(CurrentSequence);
+		}
+		return;
+	}
+
+	// Find the state the server made these against
+	FGraspMirrorState State;
+	if (Corrections.BaselineSequence != 0)
+	{
+		const FGraspMirrorState* Baseline = MirrorHistory.FindByPredicate([&Corrections](const FGraspMirrorState& Entry)
+		{
+			return Entry.Sequence == Corrections.BaselineSequence;
+		});
+
+		// Lost the baseline, have the server send everything against the empty set instead
+		if (!Baseline)
+		{
+			ServerAckMirrorCorrections(0);
+			return;
+		}
+		State.Granted = Baseline->Granted;
+	}
+
+	// Graspables we can't resolve arrive as null and are skipped
+	State.Sequence = Corrections.Sequence;
+	State.Granted.RemoveAll([](const TWeakObjectPtr<const UPrimitiveComponent>& Graspable) { return !Graspable.IsValid(); });
+	for (int32 i = 0; i < Corrections.Num(); i++)
+	{
+		if (const UPrimitiveComponent* Component = Corrections.Graspables[i].Get())
+		{
+			if (Corrections.IsGranted(i))
+			{
+				State.Granted.AddUnique(Component);
+			}
+			else
+			{
+				State.Granted.Remove(Component);
+			}
+		}
+	}
+	GraspMirror::AddToHistory(MirrorHistory, MoveTemp(State));
+	ServerAckMirrorCorrections(Corrections.Sequence);
+
+	if (UpdateLocalScanGrantedState())
+	{
+		OnLocalScanUpdated.Broadcast(this, LocalScanResults);
+	}
+}
+
+void UGraspComponent::ServerAckMirrorCorrections_Implementation(uint16 Sequence)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::ServerAckMirrorCorrections);
+
+	// The client lost its baseline, diff against the empty set
+	if (Sequence == 0)
+	{
+		MirrorBaseline = {};
+		return;
+	}
+
+	// Acknowledgements are unreliable too, only move the baseline forward
+	if (!GraspMirror::IsNewerSequence(Sequence, MirrorBaseline.Sequence))
+	{
+		return;
+	}
+
+	// States older than the history can't be used as a baseline, the next acknowledgement will be recent enough
+	if (const FGraspMirrorState* State = MirrorHistory.FindByPredicate([Sequence](const FGraspMirrorState& Entry)
+		{
+			return Entry.Sequence == Sequence;
+		}))
+	{
+		MirrorBaseline = *State;
+	}
+}
+
+bool UGraspComponent::UpdateLocalScanGrantedState()
+{
+	bool bChanged = false;
+	for (FGraspLocalScanResult& Result : LocalScanResults)
+	{
+		const bool bGranted = IsGraspableAbilityGranted(Result.Graspable.Get());
+		bChanged |= Result.bAbilityGranted != bGranted;
+		Result.bAbilityGranted = bGranted;
+	}
+	return bChanged;
+}
+
 bool UGraspComponent::IsGrantedGameplayAbilityInRange(TSubclassOf<UGameplayAbility> InAbility) const
 {
 	// Anything in current scan results is in range, if it has the ability we are looking for
@@ -639,13 +1329,7 @@ bool UGraspComponent::ClearGrantedGameplayAbility(TSubclassOf<UGameplayAbility>
 	// Don't clear locked abilities unless specified
 	if (!bClearLockedAbilities)
 	{
-		// Clear any weak null ability locks
-		Data->LockedGraspables.RemoveAll([](const TWeakObjectPtr<const UPrimitiveComponent>& WeakGraspable)
-		{
-			return !WeakGraspable.IsValid();
-		});
-
-		if (Data->LockedGraspables.Num() > 0)
+		if (IsAbilityLocked(*Data))
 		{
 			return false;
 		}
@@ -655,6 +1339,7 @@ bool UGraspComponent::ClearGrantedGameplayAbility(TSubclassOf<UGameplayAbility>
 	
 	ASC->ClearAbility(Data->Handle);
 	AbilityData.Remove(InAbility);
+	ParkedGraspAbilities.Remove(InAbility);
 
 	return true;
 }
@@ -704,13 +1389,7 @@ void UGraspComponent::ClearAllGrantedGameplayAbilities(bool bClearCommonAbilitie
 		// Don't clear locked abilities unless specified
 		if (!bClearLockedAbilities)
 		{
-			// Clear any weak null ability locks
-			Data.LockedGraspables.RemoveAll([](const TWeakObjectPtr<const UPrimitiveComponent>& WeakGraspable)
-			{
-				return !WeakGraspable.IsValid();
-			});
-
-			if (Data.LockedGraspables.Num() > 0)
+			if (IsAbilityLocked(Data))
 			{
 				continue;
 			}
@@ -731,6 +1410,8 @@ void UGraspComponent::ClearAllGrantedGameplayAbilities(bool bClearCommonAbilitie
 		const UGraspData* GraspData = ValidComponent ? CastChecked<IGraspableComponent>(ValidComponent->Get())->GetGraspData() : nullptr;
 		PreClearGraspAbility(Data.Ability, GraspData, Data);
 		ASC->ClearAbility(Data.Handle);
+		ParkedGraspAbilities.Remove(Entry.Key);
+		Data.bParked = false;
 		Data.Handle = FGameplayAbilitySpecHandle();
 		Data.Spec = FGameplayAbilitySpec();
 		Data.Ability = nullptr;
@@ -759,6 +1440,70 @@ void UGraspComponent::ClearAllGrantedGameplayAbilities(bool bClearCommonAbilitie
 	}
 }
 
+bool UGraspComponent::IsGraspAbilityParked(TSubclassOf<UGameplayAbility> InAbility) const
+{
+	if (const FGraspAbilityData* Data = AbilityData.Find(InAbility))
+	{
+		return Data->bParked;
+	}
+
+	// Clients only have the replicated spec
+	const FGameplayAbilitySpec* Spec = InAbility && GetASC() ? GetASC()->FindAbilitySpecFromClass(InAbility) : nullptr;
+	return Spec && Spec->GetDynamicSpecSourceTags().HasTagExact(FGraspTags::Grasp_Ability_Parked);
+}
+
+void UGraspComponent::ParkGraspAbility(TSubclassOf<UGameplayAbility> InAbility, FGraspAbilityData& Data)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::ParkGraspAbility);
+
+	UE_LOG(LogGrasp, Verbose, TEXT("%s GraspComponent::ParkGraspAbility: Parking ability %s"),
+		*GetRoleString(), *GetNameSafe(InAbility));
+
+	Data.bParked = true;
+	ParkedGraspAbilities.Remove(InAbility);
+	ParkedGraspAbilities.Add(InAbility);
+
+	// Tag the spec so clients can't activate it either
+	if (FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Data.Handle))
+	{
+		Spec->GetDynamicSpecSourceTags().AddTag(FGraspTags::Grasp_Ability_Parked);
+		ASC->MarkAbilitySpecDirty(*Spec);
+	}
+
+	// Clear the least recently parked abilities
+	while (ParkedGraspAbilities.Num() > MaxParkedGraspAbilities)
+	{
+		const TSubclassOf<UGameplayAbility> Evicted = ParkedGraspAbilities[0];
+		ParkedGraspAbilities.RemoveAt(0, EAllowShrinking::No);
+
+		if (const FGraspAbilityData* EvictedData = AbilityData.Find(Evicted))
+		{
+			UE_LOG(LogGrasp, Verbose, TEXT("%s GraspComponent::ParkGraspAbility: Removing parked ability %s"),
+				*GetRoleString(), *GetNameSafe(Evicted));
+
+			if (EvictedData->Handle.IsValid())
+			{
+				ASC->ClearAbility(EvictedData->Handle);
+			}
+			AbilityData.Remove(Evicted);
+		}
+	}
+}
+
+void UGraspComponent::UnparkGraspAbility(TSubclassOf<UGameplayAbility> InAbility, FGraspAbilityData& Data)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::UnparkGraspAbility);
+
+	Data.bParked = false;
+	ParkedGraspAbilities.Remove(InAbility);
+
+	if (FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Data.Handle))
+	{
+		Spec->GetDynamicSpecSourceTags().RemoveTag(FGraspTags::Grasp_Ability_Parked);
+		ASC->MarkAbilitySpecDirty(*Spec);
+	}
+}
+
 bool UGraspComponent::AddAbilityLock(const UPrimitiveComponent* GraspableComponent)
 {
 	if (!IsValid(GraspableComponent))
@@ -778,11 +1523,8 @@ bool UGraspComponent::AddAbilityLock(const UPrimitiveComponent* GraspableCompone
 	// Add lock to ability data
 	if (FGraspAbilityData* Data = AbilityData.Find(Ability))
 	{
-		if (!Data->LockedGraspables.Contains(GraspableComponent))
-		{
-			Data->LockedGraspables.Add(GraspableComponent);
-			return true;
-		}
+		Data->LockedGraspables.FindOrAdd(TObjectKey<UPrimitiveComponent>(GraspableComponent), 0)++;
+		return true;
 	}
 
 	return false;
@@ -807,24 +1549,13 @@ bool UGraspComponent::RemoveAbilityLock(const UPrimitiveComponent* GraspableComp
 	// Remove lock from ability data
 	if (FGraspAbilityData* Data = AbilityData.Find(Ability))
 	{
-		if (Data->LockedGraspables.Contains(GraspableComponent))
+		const TObjectKey<UPrimitiveComponent> Key(GraspableComponent);
+		if (int32* LockCount = Data->LockedGraspables.Find(Key))
 		{
-			Data->LockedGraspables.Remove(GraspableComponent);
-
-			// If this is the last locked graspable, we can remove the ability, if it isn't in range
-			if (Data->LockedGraspables.Num() == 0)
+			if (--(*LockCount) <= 0)
 			{
-				if (!IsGrantedGameplayAbilityInRange(Ability))
-				{
-					// Clear the ability
-					const UGraspData* GraspData = Graspable->GetGraspData();
-					PreClearGraspAbility(Data->Ability, GraspData, *Data);
-					ASC->ClearAbility(Data->Handle);
-					Data->Handle = FGameplayAbilitySpecHandle();
-					Data->Spec = FGameplayAbilitySpec();
-					Data->Ability = nullptr;
-					AbilityData.Remove(Ability);
-				}
+				Data->LockedGraspables.Remove(Key);
+				ClearUnlockedAbility(Ability, Graspable->GetGraspData());
 			}
 			
 			return true;
@@ -834,6 +1565,92 @@ bool UGraspComponent::RemoveAbilityLock(const UPrimitiveComponent* GraspableComp
 	return false;
 }
 
+bool UGraspComponent::IsAbilityLocked(const FGraspAbilityData& Data) const
+{
+	// Destroyed graspables release their locks via OnGraspableUnregistered() and OnPostGarbageCollect()
+	return Data.LockedGraspables.Num() > 0;
+}
+
+void UGraspComponent::ClearUnlockedAbility(TSubclassOf<UGameplayAbility> InAbility, const UGraspData* GraspData)
+{
+	// If this was the last locked graspable, we can remove the ability, if it isn't in range
+	FGraspAbilityData* Data = ASC.IsValid() ? AbilityData.Find(InAbility) : nullptr;
+	if (!Data || IsAbilityLocked(*Data) || IsGrantedGameplayAbilityInRange(InAbility))
+	{
+		return;
+	}
+
+	// Clear the ability
+	PreClearGraspAbility(Data->Ability, GraspData, *Data);
+	ASC->ClearAbility(Data->Handle);
+	Data->Handle = FGameplayAbilitySpecHandle();
+	Data->Spec = FGameplayAbilitySpec();
+	Data->Ability = nullptr;
+	AbilityData.Remove(InAbility);
+}
+
+void UGraspComponent::OnGraspableUnregistered(const UPrimitiveComponent* GraspableComponent)
+{
+	// Components also unregister when re-registered or streamed out, their locks remain until they are destroyed
+	const AActor* Owner = GraspableComponent ? GraspableComponent->GetOwner() : nullptr;
+	if (IsValid(GraspableComponent) && !GraspableComponent->IsBeingDestroyed() && !(Owner && Owner->IsActorBeingDestroyed()))
+	{
+		return;
+	}
+
+	// Release every lock the graspable holds, then clear abilities it was the last lock on
+	const TObjectKey<UPrimitiveComponent> Key(GraspableComponent);
+	TArray<TSubclassOf<UGameplayAbility>, TInlineAllocator<4>> Unlocked;
+	for (auto& Entry : AbilityData)
+	{
+		if (Entry.Value.LockedGraspables.Remove(Key) > 0 && Entry.Value.LockedGraspables.Num() == 0)
+		{
+			Unlocked.Add(Entry.Key);
+		}
+	}
+
+	const IGraspableComponent* Graspable = Cast<IGraspableComponent>(GraspableComponent);
+	const UGraspData* GraspData = Graspable ? Graspable->GetGraspData() : nullptr;
+	for (const TSubclassOf<UGameplayAbility>& Ability : Unlocked)
+	{
+		ClearUnlockedAbility(Ability, GraspData);
+	}
+}
+
+void UGraspComponent::OnPostGarbageCollect()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::OnPostGarbageCollect);
+
+	// Release locks held by graspables that were destroyed without unregistering from UGraspSubsystem
+	TArray<TSubclassOf<UGameplayAbility>, TInlineAllocator<4>> Unlocked;
+	for (auto& Entry : AbilityData)
+	{
+		TMap<TObjectKey<UPrimitiveComponent>, int32>& LockedGraspables = Entry.Value.LockedGraspables;
+		if (LockedGraspables.Num() == 0)
+		{
+			continue;
+		}
+
+		for (auto It = LockedGraspables.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		if (LockedGraspables.Num() == 0)
+		{
+			Unlocked.Add(Entry.Key);
+		}
+	}
+
+	for (const TSubclassOf<UGameplayAbility>& Ability : Unlocked)
+	{
+		ClearUnlockedAbility(Ability, nullptr);
+	}
+}
+
 bool UGraspComponent::HasValidData() const
 {
 	return IsValid(Controller) && ASC.IsValid();
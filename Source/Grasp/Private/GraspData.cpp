@@ -16,12 +16,40 @@ TSubclassOf<UGameplayAbility> UGraspData::GetGraspAbility_Implementation() const
 	return GraspAbility;
 }
 
+void UGraspData::CacheInputTagContainer()
+{
+	InputTagContainer.Reset();
+	if (InputTag.IsValid())
+	{
+		InputTagContainer.AddTag(InputTag);
+	}
+}
+
+void UGraspData::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CacheInputTagContainer();
+}
+
+void UGraspData::PostLoad()
+{
+	Super::PostLoad();
+
+	CacheInputTagContainer();
+}
+
 #if WITH_EDITOR
 
 void UGraspData::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	if (PropertyChangedEvent.GetPropertyName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, InputTag)))
+	{
+		CacheInputTagContainer();
+	}
+
 	if (PropertyChangedEvent.GetPropertyName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, MaxGraspDistance)) ||
 		PropertyChangedEvent.GetPropertyName().IsEqual(GET_MEMBER_NAME_CHECKED(ThisClass, MaxHighlightDistance)))
 	{
@@ -0,0 +1,98 @@
+// Copyright (c) Jared Taylor
+
+#include "GraspLevelIndex.h"
+#include "GraspTypes.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/CustomVersion.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspLevelIndex)
+
+const FGuid FGraspLevelIndexVersion::GUID(0xBB4A7D4E, 0x84054EE0, 0xB97A55F1, 0xDC4E1C72);
+
+static FCustomVersionRegistration GRegisterGraspLevelIndexVersion(FGraspLevelIndexVersion::GUID,
+	FGraspLevelIndexVersion::LatestVersion, TEXT("GraspLevelIndex"));
+
+UPrimitiveComponent* UGraspLevelIndex::ResolveComponent(const ULevel* Level, int32 EntryIndex) const
+{
+	if (!Level || !ActorNames.IsValidIndex(EntryIndex) || !ComponentNames.IsValidIndex(EntryIndex))
+	{
+		return nullptr;
+	}
+
+	// Names are relative to the level, so this also works for PIE and instanced levels
+	const AActor* Actor = FindObjectFast<AActor>(const_cast<ULevel*>(Level), ActorNames[EntryIndex]);
+	if (!Actor || Actor->IsPendingKillPending())
+	{
+		return nullptr;
+	}
+
+	return FindObjectFast<UPrimitiveComponent>(const_cast<AActor*>(Actor), ComponentNames[EntryIndex]);
+}
+
+int32 UGraspLevelIndex::FindEntry(const UPrimitiveComponent* Component) const
+{
+	const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	if (!Owner)
+	{
+		return INDEX_NONE;
+	}
+
+	if (EntryLookup.Num() == 0 && ComponentNames.Num() > 0)
+	{
+		EntryLookup.Reserve(ComponentNames.Num());
+		for (int32 Index = 0; Index < ComponentNames.Num() && ActorNames.IsValidIndex(Index); ++Index)
+		{
+			EntryLookup.Add({ ActorNames[Index], ComponentNames[Index] }, Index);
+		}
+	}
+
+	const int32* Index = EntryLookup.Find({ Owner->GetFName(), Component->GetFName() });
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UGraspLevelIndex::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	Ar.UsingCustomVersion(FGraspLevelIndexVersion::GUID);
+
+	const int32 Version = Ar.CustomVer(FGraspLevelIndexVersion::GUID);
+	if (!Ar.IsLoading() || Version == FGraspLevelIndexVersion::LatestVersion)
+	{
+		Entries.BulkSerialize(Ar);
+		return;
+	}
+
+	// Unversioned bakes were bulk serialized, skip over them instead of reading them. The original 44 byte entries
+	// were followed by a bulk array of GraspData indices. Neither had padding, so each array is its element size
+	// times its count
+	if (Version <= FGraspLevelIndexVersion::BeforeCustomVersionWasAdded)
+	{
+		int32 NumArrays = 1;
+		for (int32 Array = 0; Array < NumArrays && !Ar.IsError(); Array++)
+		{
+			int32 SerializedElementSize = 0;
+			int32 SerializedNum = 0;
+			Ar << SerializedElementSize;
+			Ar << SerializedNum;
+			if (SerializedElementSize > 0 && SerializedNum > 0)
+			{
+				Ar.Seek(Ar.Tell() + (int64)SerializedElementSize * SerializedNum);
+			}
+			if (Array == 0 && SerializedElementSize == 44)
+			{
+				NumArrays = 2;
+			}
+		}
+	}
+
+	// Without any entries the level's graspables register themselves at runtime
+	Entries.Empty();
+	ActorNames.Empty();
+	ComponentNames.Empty();
+
+	UE_LOG(LogGrasp, Warning, TEXT("%s: Discarding graspable index baked with version %d, expected %d. Rebake it with the GraspBakeIndex commandlet."),
+		*GetPathName(), Version, (int32)FGraspLevelIndexVersion::LatestVersion);
+}
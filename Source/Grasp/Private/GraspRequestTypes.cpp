@@ -0,0 +1,67 @@
+// Copyright (c) Jared Taylor
+
+#include "GraspRequestTypes.h"
+#include "GraspData.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspRequestTypes)
+
+FGraspRequestFilterMatcher::FGraspRequestFilterMatcher(const FGraspRequestFilter& InFilter)
+	: Filter(InFilter)
+	, bMatchAnyTag(InFilter.TagRequirements.IsEmpty())
+{
+}
+
+void FGraspRequestFilterMatcher::Compile(const UGraspData* GraspData)
+{
+	check(IsInGameThread());
+
+	if (bMatchAnyTag || !GraspData || !GraspData->InputTag.IsValid())
+	{
+		return;
+	}
+
+	if (CompiledTags.Contains(GraspData->InputTag))
+	{
+		return;
+	}
+
+	const int32 Bit = TagResults.Add(Filter.TagRequirements.Matches(GraspData->GetInputTagContainer()));
+	CompiledTags.Add(GraspData->InputTag, Bit);
+}
+
+bool FGraspRequestFilterMatcher::MatchesTag(const UGraspData* GraspData) const
+{
+	if (bMatchAnyTag)
+	{
+		return true;
+	}
+
+	// Filter requires tags but this GraspData has no InputTag
+	if (!GraspData->InputTag.IsValid())
+	{
+		return false;
+	}
+
+	if (const int32* Bit = CompiledTags.Find(GraspData->InputTag))
+	{
+		return TagResults[*Bit];
+	}
+
+	// Not compiled, evaluate against the cached container which doesn't allocate either
+	return Filter.TagRequirements.Matches(GraspData->GetInputTagContainer());
+}
+
+bool FGraspRequestFilterMatcher::Matches(const UGraspData* GraspData) const
+{
+	if (!GraspData)
+	{
+		return false;
+	}
+
+	if (Filter.GraspDataClass && !GraspData->IsA(Filter.GraspDataClass))
+	{
+		return false;
+	}
+
+	return MatchesTag(GraspData);
+}
@@ -22,6 +22,7 @@
 #include "GraspableComponent.h"
 #include "GraspData.h"
 #include "GraspDeveloper.h"
+#include "GraspSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspScanTask)
 
@@ -88,6 +89,13 @@ void UGraspScanTask::Activate()
 	UE_LOG(LogGrasp, Verbose, TEXT("%s GraspScanTask::Activate"), *GetRoleString());
 
 	SetWaitingOnAvatar();
+
+	// The subsystem watchdog retries us if the TargetingSubsystem loses our requests
+	if (UGraspSubsystem* Subsystem = UGraspSubsystem::Get(this))
+	{
+		Subsystem->RegisterScanner(this);
+	}
+
 	RequestGrasp();
 }
 
@@ -320,11 +328,9 @@ void UGraspScanTask::RequestGrasp()
 			continue;
 		}
 
+		// Reuses the handle from our last scan with this preset where possible
 		FTargetingRequestHandle& Handle = GC->TargetingRequests.FindOrAdd(Tag);
-		Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
-
-		FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Handle);
-		AsyncTaskData.bReleaseOnCompletion = true;
+		Handle = GC->AcquireTargetingRequest(TargetSubsystem, Tag, Preset, TargetingSource);
 
 		bAwaitingCallback = true;
 
@@ -350,6 +356,8 @@ void UGraspScanTask::RequestGrasp()
 		return;
 	}
 
+	LastRequestTime = GetWorld()->GetTimeSeconds();
+
 #if UE_ENABLE_DEBUG_DRAWING
 	if (IsInGameThread() && GEngine && Ability && Ability->GetCurrentActorInfo())
 	{
@@ -408,7 +416,7 @@ void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FG
 	}
 
 	// Get the results from the TargetingSubsystem
-	TArray<FGraspScanResult> ScanResults;
+	ScanResults.Reset();
 	if (TargetingHandle.IsValid())
 	{
 		// Process results
@@ -435,8 +443,7 @@ void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FG
 				const float NormalizedDistance = Hit.Distance / GraspAbilityRadius;
 
 				// Add the result to the array
-				FGraspScanResult Result = { ScanTag, Hit.GetComponent(), NormalizedDistance };
-				ScanResults.Add(Result);
+				ScanResults.Emplace(FGraspScanResult{ ScanTag, Hit.GetComponent(), NormalizedDistance });
 			}
 		}
 
@@ -459,22 +466,6 @@ void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FG
 		// Request the next Grasp
 		RequestGrasp();
 	}
-
-	// Fail-safe timer to ensure we don't hang indefinitely -- this occurs due to an engine bug where the TargetingSubsystem
-	// loses all of its requests when another player joins (so far confirmed for running under one process in PIE only)
-	auto OnFailsafeTimer = [this]
-	{
-		if (GC.IsValid() && GC->TargetingRequests.Num() > 0)
-		{
-			UE_LOG(LogGrasp, Error, TEXT("%s GraspScanTask hung with %d targeting requests. Retrying..."), *GetRoleString(), GC->TargetingRequests.Num());
-			GC->EndAllTargetingRequests();
-			RequestGrasp();
-		}
-	};
-
-	// Weak Lambda is used because OnDestroy isn't called at the correct point in the engine lifecycle after UEngine::Browse (open map)
-	GetWorld()->GetTimerManager().SetTimer(FailsafeTimer, FTimerDelegate::CreateWeakLambda(this, OnFailsafeTimer),
-		FailsafeDelay, false);
 }
 
 void UGraspScanTask::OnPauseGrasp(bool bPaused)
@@ -515,10 +506,29 @@ void UGraspScanTask::OnRequestGrasp()
 	}
 }
 
+void UGraspScanTask::RetryIfHung(double TimeSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspScanTask::RetryIfHung);
+
+	// Fail-safe to ensure we don't hang indefinitely -- this occurs due to an engine bug where the TargetingSubsystem
+	// loses all of its requests when another player joins (so far confirmed for running under one process in PIE only)
+	if (GC.IsValid() && GC->TargetingRequests.Num() > 0 && TimeSeconds - LastRequestTime > FailsafeDelay)
+	{
+		UE_LOG(LogGrasp, Error, TEXT("%s GraspScanTask hung with %d targeting requests. Retrying..."), *GetRoleString(), GC->TargetingRequests.Num());
+		GC->EndAllTargetingRequests();
+		RequestGrasp();
+	}
+}
+
 void UGraspScanTask::OnDestroy(bool bInOwnerFinished)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspScanTask::OnDestroy);
 
+	if (UGraspSubsystem* Subsystem = UGraspSubsystem::Get(this))
+	{
+		Subsystem->UnregisterScanner(this);
+	}
+
 	if (IsValid(GetWorld()))
 	{
 		GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
@@ -22,7 +22,10 @@
 #endif
 
 #include "GraspableOwner.h"
+#include "SceneView.h"
 #include "Blueprint/SlateBlueprintLibrary.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Engine/LocalPlayer.h"
 #include "Components/Widget.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -224,6 +227,12 @@ bool UGraspStatics::CanGraspActivateAbility(const AActor* SourceActor, const UPr
 		return false;
 	}
 
+	// Parked abilities are out of range, they are only granted for reuse
+	if (Spec->GetDynamicSpecSourceTags().HasTagExact(FGraspTags::Grasp_Ability_Parked))
+	{
+		return false;
+	}
+
 	// Check if we can activate the ability
 	const FGameplayAbilityActorInfo* ActorInfo = ASC->AbilityActorInfo.Get();
 	FGameplayTagContainer RelevantTags;
@@ -305,6 +314,12 @@ bool UGraspStatics::TryActivateGraspAbility(const AActor* SourceActor, UPrimitiv
 		return false;
 	}
 
+	// Parked abilities are out of range, they are only granted for reuse
+	if (Spec->GetDynamicSpecSourceTags().HasTagExact(FGraspTags::Grasp_Ability_Parked))
+	{
+		return false;
+	}
+
 	// Optionally add the input tag to the ability spec
 	const UGraspData* GraspDataEntry = Graspable->GetGraspData(GraspDataIndex);
 	if (GraspDataEntry && GraspDataEntry->InputTag.IsValid())
@@ -632,72 +647,86 @@ void UGraspStatics::FlushServerMoves(ACharacter* Character)
 	}
 }
 
-EGraspCardinal_4Way UGraspStatics::GetCardinalDirectionFromAngle_4Way(float Angle)
+namespace GraspCardinal
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetCardinalDirectionFromAngle_4Way);
-	
-	const float AngleAbs = FMath::Abs(Angle);
-
-	// Forward
-	if (AngleAbs <= 45.f)
-	{
-		return EGraspCardinal_4Way::Forward;
-	}
-
-	// Backward
-	if (AngleAbs >= 135.f)
-	{
-		return EGraspCardinal_4Way::Backward;
-	}
-
-	// Right
-	if (Angle > 0.f)
-	{
-		return EGraspCardinal_4Way::Right;
+	using E4 = EGraspCardinal_4Way;
+	using E8 = EGraspCardinal_8Way;
+
+	/** Cardinal by sector, then by side (0 = left or exactly forward/backward, 1 = right) */
+	static constexpr E4 Sectors_4Way[3][2] = {
+		{ E4::Forward, E4::Forward },
+		{ E4::Left, E4::Right },
+		{ E4::Backward, E4::Backward },
+	};
+
+	static constexpr E8 Sectors_8Way[5][2] = {
+		{ E8::Forward, E8::Forward },
+		{ E8::ForwardLeft, E8::ForwardRight },
+		{ E8::Left, E8::Right },
+		{ E8::BackwardLeft, E8::BackwardRight },
+		{ E8::Backward, E8::Backward },
+	};
+
+	/** Opposite of each cardinal, indexed by the cardinal */
+	static constexpr E4 Opposite_4Way[4] = { E4::Backward, E4::Right, E4::Left, E4::Forward };
+	static constexpr E8 Opposite_8Way[8] = {
+		E8::Backward, E8::BackwardRight, E8::BackwardLeft, E8::Right, E8::Left, E8::Forward, E8::ForwardRight, E8::ForwardLeft
+	};
+
+	/** Unit direction (X, Y) of each cardinal, indexed by the cardinal */
+	static constexpr double InvSqrt2 = 0.70710678118654752440;
+	static constexpr double Directions_4Way[4][2] = { { 1.0, 0.0 }, { 0.0, -1.0 }, { 0.0, 1.0 }, { -1.0, 0.0 } };
+	static constexpr double Directions_8Way[8][2] = {
+		{ 1.0, 0.0 }, { InvSqrt2, -InvSqrt2 }, { InvSqrt2, InvSqrt2 }, { 0.0, -1.0 },
+		{ 0.0, 1.0 }, { -1.0, 0.0 }, { -InvSqrt2, -InvSqrt2 }, { -InvSqrt2, InvSqrt2 },
+	};
+
+	/** Sector boundaries match the original comparisons exactly: forward is inclusive, backward is inclusive */
+	FORCEINLINE E4 FromAngle_4Way(float Angle)
+	{
+		const float AngleAbs = FMath::Abs(Angle);
+		const int32 Sector = (AngleAbs > 45.f) + (AngleAbs >= 135.f);
+		return Sectors_4Way[Sector][Angle > 0.f];
+	}
+
+	FORCEINLINE E8 FromAngle_8Way(float Angle)
+	{
+		const float AngleAbs = FMath::Abs(Angle);
+		const int32 Sector = (AngleAbs > 22.5f) + (AngleAbs > 67.5f) + (AngleAbs >= 112.5f) + (AngleAbs >= 157.5f);
+		return Sectors_8Way[Sector][Angle > 0.f];
 	}
+}
 
-	// Left
-	return EGraspCardinal_4Way::Left;
+EGraspCardinal_4Way UGraspStatics::GetCardinalDirectionFromAngle_4Way(float Angle)
+{
+	return GraspCardinal::FromAngle_4Way(Angle);
 }
 
 EGraspCardinal_8Way UGraspStatics::GetCardinalDirectionFromAngle_8Way(float Angle)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetCardinalDirectionFromAngle_8Way);
-	
-	const float AngleAbs = FMath::Abs(Angle);
-
-	// Forward
-	if (AngleAbs <= 22.5f)
-	{
-		return EGraspCardinal_8Way::Forward;
-	}
+	return GraspCardinal::FromAngle_8Way(Angle);
+}
 
-	// Backward
-	if (AngleAbs >= 157.5f)
-	{
-		return EGraspCardinal_8Way::Backward;
-	}
+void UGraspStatics::GetCardinalDirectionsFromAngles_4Way(TConstArrayView<float> Angles, TArrayView<EGraspCardinal_4Way> OutCardinals)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetCardinalDirectionsFromAngles_4Way);
 
-	// Diagonal Fwd
-	if (AngleAbs <= 67.5f)
+	check(Angles.Num() == OutCardinals.Num());
+	for (int32 i = 0; i < Angles.Num(); i++)
 	{
-		return Angle > 0.f ? EGraspCardinal_8Way::ForwardRight : EGraspCardinal_8Way::ForwardLeft;
+		OutCardinals[i] = GraspCardinal::FromAngle_4Way(Angles[i]);
 	}
+}
 
-	// Diagonal Bwd
-	if (AngleAbs >= 112.5f)
-	{
-		return Angle > 0.f ? EGraspCardinal_8Way::BackwardRight : EGraspCardinal_8Way::BackwardLeft;
-	}
+void UGraspStatics::GetCardinalDirectionsFromAngles_8Way(TConstArrayView<float> Angles, TArrayView<EGraspCardinal_8Way> OutCardinals)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetCardinalDirectionsFromAngles_8Way);
 
-	// Right
-	if (Angle > 0.f)
+	check(Angles.Num() == OutCardinals.Num());
+	for (int32 i = 0; i < Angles.Num(); i++)
 	{
-		return EGraspCardinal_8Way::Right;
+		OutCardinals[i] = GraspCardinal::FromAngle_8Way(Angles[i]);
 	}
-
-	// Left
-	return EGraspCardinal_8Way::Left;
 }
 
 float UGraspStatics::CalculateCardinalAngle(const FVector& Direction, const FRotator& SourceRotation)
@@ -751,34 +780,46 @@ EGraspCardinal_8Way UGraspStatics::CalculateCardinalDirection_8Way(const FVector
 	return GetCardinalDirectionFromAngle_8Way(Angle);
 }
 
-EGraspCardinal_4Way UGraspStatics::GetOppositeCardinalDirection_4Way(EGraspCardinal_4Way Cardinal)
+void UGraspStatics::CalculateCardinalDirections_4Way(const TArray<FVector>& SourceLocations,
+	const TArray<FRotator>& SourceRotations, const TArray<FVector>& TargetLocations, TArray<EGraspCardinal_4Way>& OutCardinals)
 {
-	switch (Cardinal)
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::CalculateCardinalDirections_4Way);
+
+	const int32 Num = FMath::Min3(SourceLocations.Num(), SourceRotations.Num(), TargetLocations.Num());
+	OutCardinals.SetNumUninitialized(Num);
+	for (int32 i = 0; i < Num; i++)
 	{
-	case EGraspCardinal_4Way::Forward: return EGraspCardinal_4Way::Backward;
-	case EGraspCardinal_4Way::Backward: return EGraspCardinal_4Way::Forward;
-	case EGraspCardinal_4Way::Left: return EGraspCardinal_4Way::Right;
-	case EGraspCardinal_4Way::Right: return EGraspCardinal_4Way::Left;
-	default: return Cardinal;
+		const float Angle = CalculateCardinalAngle(TargetLocations[i] - SourceLocations[i], SourceRotations[i]);
+		OutCardinals[i] = GraspCardinal::FromAngle_4Way(Angle);
 	}
 }
 
-EGraspCardinal_8Way UGraspStatics::GetOppositeCardinalDirection_8Way(EGraspCardinal_8Way Cardinal)
+void UGraspStatics::CalculateCardinalDirections_8Way(const TArray<FVector>& SourceLocations,
+	const TArray<FRotator>& SourceRotations, const TArray<FVector>& TargetLocations, TArray<EGraspCardinal_8Way>& OutCardinals)
 {
-	switch (Cardinal)
-	{
-	case EGraspCardinal_8Way::Forward: return EGraspCardinal_8Way::Backward;
-	case EGraspCardinal_8Way::Backward: return EGraspCardinal_8Way::Forward;
-	case EGraspCardinal_8Way::Left: return EGraspCardinal_8Way::Right;
-	case EGraspCardinal_8Way::Right: return EGraspCardinal_8Way::Left;
-	case EGraspCardinal_8Way::ForwardLeft: return EGraspCardinal_8Way::BackwardRight;
-	case EGraspCardinal_8Way::ForwardRight: return EGraspCardinal_8Way::BackwardLeft;
-	case EGraspCardinal_8Way::BackwardLeft: return EGraspCardinal_8Way::ForwardRight;
-	case EGraspCardinal_8Way::BackwardRight: return EGraspCardinal_8Way::ForwardLeft;
-	default: return Cardinal;
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::CalculateCardinalDirections_8Way);
+
+	const int32 Num = FMath::Min3(SourceLocations.Num(), SourceRotations.Num(), TargetLocations.Num());
+	OutCardinals.SetNumUninitialized(Num);
+	for (int32 i = 0; i < Num; i++)
+	{
+		const float Angle = CalculateCardinalAngle(TargetLocations[i] - SourceLocations[i], SourceRotations[i]);
+		OutCardinals[i] = GraspCardinal::FromAngle_8Way(Angle);
 	}
 }
 
+EGraspCardinal_4Way UGraspStatics::GetOppositeCardinalDirection_4Way(EGraspCardinal_4Way Cardinal)
+{
+	const uint8 Index = static_cast<uint8>(Cardinal);
+	return Index < UE_ARRAY_COUNT(GraspCardinal::Opposite_4Way) ? GraspCardinal::Opposite_4Way[Index] : Cardinal;
+}
+
+EGraspCardinal_8Way UGraspStatics::GetOppositeCardinalDirection_8Way(EGraspCardinal_8Way Cardinal)
+{
+	const uint8 Index = static_cast<uint8>(Cardinal);
+	return Index < UE_ARRAY_COUNT(GraspCardinal::Opposite_8Way) ? GraspCardinal::Opposite_8Way[Index] : Cardinal;
+}
+
 FVector UGraspStatics::GetDirectionFromCardinal_4Way(EGraspCardinal_4Way Cardinal, const FRotator& SourceRotation)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetDirectionFromCardinal_4Way);
@@ -793,46 +834,22 @@ FVector UGraspStatics::GetDirectionFromCardinal_8Way(EGraspCardinal_8Way Cardina
 
 FVector UGraspStatics::GetSnappedDirectionFromCardinal_4Way(EGraspCardinal_4Way Cardinal)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetSnappedDirectionFromCardinal_4Way);
-	switch (Cardinal)
-	{
-	case EGraspCardinal_4Way::Forward:
-		return FVector(1.f, 0.f, 0.f);
-	case EGraspCardinal_4Way::Backward:
-		return FVector(-1.f, 0.f, 0.f);
-	case EGraspCardinal_4Way::Left:
-		return FVector(0.f, -1.f, 0.f);
-	case EGraspCardinal_4Way::Right:
-		return FVector(0.f, 1.f, 0.f);
-	default:
+	const uint8 Index = static_cast<uint8>(Cardinal);
+	if (Index >= UE_ARRAY_COUNT(GraspCardinal::Directions_4Way))
+	{
 		return FVector::ZeroVector;
 	}
+	return FVector(GraspCardinal::Directions_4Way[Index][0], GraspCardinal::Directions_4Way[Index][1], 0.0);
 }
 
 FVector UGraspStatics::GetSnappedDirectionFromCardinal_8Way(EGraspCardinal_8Way Cardinal)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetSnappedDirectionFromCardinal_8Way);
-	switch (Cardinal)
-	{
-	case EGraspCardinal_8Way::Forward:
-		return FVector(1.f, 0.f, 0.f);
-	case EGraspCardinal_8Way::Backward:
-		return FVector(-1.f, 0.f, 0.f);
-	case EGraspCardinal_8Way::Left:
-		return FVector(0.f, -1.f, 0.f);
-	case EGraspCardinal_8Way::Right:
-		return FVector(0.f, 1.f, 0.f);
-	case EGraspCardinal_8Way::ForwardLeft:
-		return FVector(1.f, -1.f, 0.f).GetSafeNormal2D();
-	case EGraspCardinal_8Way::ForwardRight:
-		return FVector(1.f, 1.f, 0.f).GetSafeNormal2D();
-	case EGraspCardinal_8Way::BackwardLeft:
-		return FVector(-1.f, -1.f, 0.f).GetSafeNormal2D();
-	case EGraspCardinal_8Way::BackwardRight:
-		return FVector(-1.f, 1.f, 0.f).GetSafeNormal2D();
-	default:
+	const uint8 Index = static_cast<uint8>(Cardinal);
+	if (Index >= UE_ARRAY_COUNT(GraspCardinal::Directions_8Way))
+	{
 		return FVector::ZeroVector;
 	}
+	return FVector(GraspCardinal::Directions_8Way[Index][0], GraspCardinal::Directions_8Way[Index][1], 0.0);
 }
 
 FVector UGraspStatics::GetDirectionSnappedToCardinal(const FVector& SourceLocation, const FRotator& SourceRotation,
@@ -995,27 +1012,27 @@ EGraspQueryResult UGraspStatics::CanInteractWith(const AActor* Interactor, const
 		return EGraspQueryResult::None;
 	}
 
-	const FVector InteractorLocation = Interactor->GetActorLocation();
-	const FVector Location = Component->GetComponentLocation();
-	const FVector Forward = Component->GetForwardVector();
-
-	const float AuthNetToleranceAngleScalar = Data->GetAuthNetToleranceAngleScalar();
-	const float AuthNetToleranceDistanceScalar = Data->GetAuthNetToleranceDistanceScalar();
-	
-	const float Angle = Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone ?
-		Data->MaxGraspAngle * AuthNetToleranceAngleScalar : Data->MaxGraspAngle;
+	const bool bApplyAuthNetTolerance = Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone;
+	const FGraspInteractParams Params = FGraspInteractParams::Make(Data, bApplyAuthNetTolerance);
 
-	const float Distance = Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone ?
-		Data->MaxGraspDistance * AuthNetToleranceDistanceScalar : Data->MaxGraspDistance;
+	return CanInteractWithParams(Interactor->GetActorLocation(), Component->GetComponentLocation(),
+		Component->GetForwardVector(), Params, NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance);
+}
 
-	const float HighlightDistance = Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone ?
-		Data->MaxHighlightDistance * AuthNetToleranceDistanceScalar : Data->MaxHighlightDistance;
+EGraspQueryResult UGraspStatics::CanInteractWithParams(const FVector& InteractorLocation, const FVector& GraspableLocation,
+	const FVector& GraspableForward, const FGraspInteractParams& Params,
+	float& NormalizedAngleDiff, float& NormalizedDistance, float& NormalizedHighlightDistance)
+{
+	NormalizedAngleDiff = 0.f;
+	NormalizedDistance = 0.f;
+	NormalizedHighlightDistance = 0.f;
 
-	const float MaxHeightAbove = Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone ?
-		Data->MaxHeightAbove * AuthNetToleranceDistanceScalar : Data->MaxHeightAbove;
+	const FVector& Location = GraspableLocation;
+	const FVector& Forward = GraspableForward;
 
-	const float MaxHeightBelow = Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone ?
-		Data->MaxHeightBelow * AuthNetToleranceDistanceScalar : Data->MaxHeightBelow;
+	const float Angle = Params.MaxGraspAngle;
+	const float Distance = Params.MaxGraspDistance;
+	const float HighlightDistance = Params.MaxHighlightDistance;
 	
 	// Check if within distance
 	if (!IsInteractableWithinDistance(Location, InteractorLocation, Distance))
@@ -1034,7 +1051,7 @@ EGraspQueryResult UGraspStatics::CanInteractWith(const AActor* Interactor, const
 		return EGraspQueryResult::None;
 	}
 
-	const float DistNormalized = Data->bGraspDistance2D ? FVector::Dist2D(Location, InteractorLocation) :
+	const float DistNormalized = Params.bGraspDistance2D ? FVector::Dist2D(Location, InteractorLocation) :
 		FVector::Dist(Location, InteractorLocation);
 	NormalizedDistance = FMath::Clamp(DistNormalized / Distance, 0.f, 1.f);
 
@@ -1048,7 +1065,7 @@ EGraspQueryResult UGraspStatics::CanInteractWith(const AActor* Interactor, const
 		FVector::Dist2D(Location, InteractorLocation) / Angle, 0.f, 1.f);
 
 	// Check if within height
-	if (!IsInteractableWithinHeight(Location, InteractorLocation, MaxHeightAbove, MaxHeightBelow))
+	if (!IsInteractableWithinHeight(Location, InteractorLocation, Params.MaxHeightAbove, Params.MaxHeightBelow))
 	{
 		return EGraspQueryResult::None;
 	}
@@ -1240,89 +1257,283 @@ FVector2D UGraspStatics::GetScreenPositionForGraspableComponent(const UPrimitive
 	return ScreenPosition;
 }
 
-EGraspInteractionLocationResult UGraspStatics::GetInteractionLocationForGraspable(const FVector& InteractorLocation,
-	const UPrimitiveComponent* GraspableComponent, FVector& OutLocation,
-	int32 GraspDataIndex, float AngleAlpha, float DistanceAlpha)
+bool UGraspStatics::GetGraspScreenCandidates(APlayerController* PlayerController,
+	const TArray<FGraspLocalScanResult>& Results, TArray<FGraspScreenCandidate>& OutCandidates, int32 MaxCandidates,
+	float DistanceWeight, bool bPreferInteractable, bool bRequireRecentlyRendered, float ScreenMargin)
 {
-	OutLocation = FVector::ZeroVector;
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspStatics::GetGraspScreenCandidates);
 
-	if (!IsValid(GraspableComponent))
+	OutCandidates.Reset();
+
+	const ULocalPlayer* LocalPlayer = IsValid(PlayerController) ? PlayerController->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer || !LocalPlayer->ViewportClient || Results.Num() == 0)
 	{
-		return EGraspInteractionLocationResult::Failed;
+		return false;
 	}
 
-	const UGraspData* GraspData = GetGraspData(GraspableComponent, GraspDataIndex);
-	if (!GraspData)
+	// Compute the view projection once for every result
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer->GetProjectionData(LocalPlayer->ViewportClient->Viewport, ProjectionData))
+	{
+		return false;
+	}
+
+	const FMatrix ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+	const FVector2D ViewMin = FVector2D(ViewRect.Min);
+	const FVector2D ViewSize = FVector2D(ViewRect.Size());
+	if (ViewSize.X <= 0.0 || ViewSize.Y <= 0.0)
 	{
-		return EGraspInteractionLocationResult::Failed;
+		return false;
 	}
 
-	const FVector GraspableLocation = GraspableComponent->GetComponentLocation();
-	const FVector GraspableForward = GraspableComponent->GetForwardVector();
+	const FVector2D Margin = ViewSize * FMath::Clamp(ScreenMargin, 0.f, 0.49f);
+	const FVector2D Center = ViewSize * 0.5;
+	const double InvHalfDiagonal = 1.0 / Center.Size();
+	const float ViewportScale = UWidgetLayoutLibrary::GetViewportScale(PlayerController);
+	const float InvViewportScale = ViewportScale > 0.f ? 1.f / ViewportScale : 1.f;
+	const float Weight = FMath::Clamp(DistanceWeight, 0.f, 1.f);
+
+	OutCandidates.Reserve(Results.Num());
+	for (const FGraspLocalScanResult& Result : Results)
+	{
+		const UPrimitiveComponent* Component = Result.Graspable.Get();
+		if (!Component || Result.QueryResult == EGraspQueryResult::None)
+		{
+			continue;
+		}
+
+		if (bRequireRecentlyRendered && !Component->WasRecentlyRendered())
+		{
+			continue;
+		}
+
+		// Behind the camera
+		FVector2D PixelPosition;
+		if (!FSceneView::ProjectWorldToScreen(Component->GetComponentLocation(), ViewRect, ViewProjectionMatrix, PixelPosition))
+		{
+			continue;
+		}
+
+		// Off-screen
+		PixelPosition -= ViewMin;
+		if (PixelPosition.X < Margin.X || PixelPosition.Y < Margin.Y ||
+			PixelPosition.X > ViewSize.X - Margin.X || PixelPosition.Y > ViewSize.Y - Margin.Y)
+		{
+			continue;
+		}
+
+		const float CenterDistance = FVector2D::Distance(PixelPosition, Center) * InvHalfDiagonal;
 
-	const float CurrentDist = GraspData->bGraspDistance2D
-		? FVector::Dist2D(InteractorLocation, GraspableLocation)
-		: FVector::Dist(InteractorLocation, GraspableLocation);
+		FGraspScreenCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+		Candidate.Graspable = Result.Graspable;
+		Candidate.GraspDataIndex = Result.GraspDataIndex;
+		Candidate.QueryResult = Result.QueryResult;
+		Candidate.ScreenPosition = PixelPosition * InvViewportScale;
+		Candidate.Score = FMath::Lerp(CenterDistance, Result.NormalizedScanDistance, Weight);
+	}
 
-	const bool bInDistance = CurrentDist <= GraspData->MaxGraspDistance;
-	const bool bInAngle = (GraspData->MaxGraspAngle >= 360.f) ||
-		IsInteractableWithinAngle(GraspableLocation, InteractorLocation, GraspableForward, GraspData->MaxGraspAngle);
+	// Stable so candidates with equal scores keep the order of the scan results
+	OutCandidates.StableSort([bPreferInteractable](const FGraspScreenCandidate& A, const FGraspScreenCandidate& B)
+	{
+		if (bPreferInteractable && A.QueryResult != B.QueryResult)
+		{
+			return A.QueryResult > B.QueryResult;
+		}
+		return A.Score < B.Score;
+	});
 
-	// Case 1: Already valid
-	if (bInDistance && bInAngle)
+	if (MaxCandidates > 0 && OutCandidates.Num() > MaxCandidates)
 	{
-		OutLocation = InteractorLocation;
-		return EGraspInteractionLocationResult::AlreadyInRange;
+		OutCandidates.SetNum(MaxCandidates);
 	}
 
-	AngleAlpha = FMath::Clamp(AngleAlpha, 0.f, 1.f);
-	DistanceAlpha = FMath::Clamp(DistanceAlpha, 0.f, 1.f);
+	return OutCandidates.Num() > 0;
+}
+
+namespace GraspInteractionLocation
+{
+	/** Everything GetInteractionLocationForGraspable needs from a graspable, gathered once per graspable */
+	struct FGraspableParams
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector Forward = FVector::ZeroVector;
 
-	const float HalfAngleDeg = GraspData->MaxGraspAngle * 0.5f;
-	const float MaxAllowedAngle = HalfAngleDeg * AngleAlpha;
-	const float TargetDistance = GraspData->MaxGraspDistance * DistanceAlpha;
+		/** Nearest valid directions on either side of the cone, pulled inward by AngleAlpha */
+		FVector PositiveEdge = FVector::ZeroVector;
+		FVector NegativeEdge = FVector::ZeroVector;
 
-	// Determine the target angle direction.
-	// If in angle: use the interactor's current direction from the graspable (just fix distance).
-	// If out of angle: clamp to the nearest edge of the valid cone.
-	FVector TargetDir;
+		float CosHalfAngle = 0.f;
+		float MaxDistance = 0.f;
+		float TargetDistance = 0.f;
+		bool bAnyAngle = false;
+		bool bDistance2D = false;
+		bool bValid = false;
+	};
 
-	if (bInAngle)
+	static FGraspableParams GatherParams(const UPrimitiveComponent* GraspableComponent, int32 GraspDataIndex,
+		float AngleAlpha, float DistanceAlpha)
 	{
-		// Case 2: In angle, out of distance. Move straight toward the graspable along current direction.
-		TargetDir = (InteractorLocation - GraspableLocation).GetSafeNormal2D();
+		FGraspableParams Params;
+		if (!IsValid(GraspableComponent))
+		{
+			return Params;
+		}
+
+		const UGraspData* GraspData = UGraspStatics::GetGraspData(GraspableComponent, GraspDataIndex);
+		if (!GraspData)
+		{
+			return Params;
+		}
+
+		AngleAlpha = FMath::Clamp(AngleAlpha, 0.f, 1.f);
+		DistanceAlpha = FMath::Clamp(DistanceAlpha, 0.f, 1.f);
+
+		const float HalfAngleDeg = GraspData->MaxGraspAngle * 0.5f;
+		const float MaxAllowedAngle = HalfAngleDeg * AngleAlpha;
+		const FVector Forward2D = GraspableComponent->GetForwardVector().GetSafeNormal2D();
+
+		Params.Location = GraspableComponent->GetComponentLocation();
+		Params.Forward = GraspableComponent->GetForwardVector();
+		Params.PositiveEdge = Forward2D.RotateAngleAxis(MaxAllowedAngle, FVector::UpVector);
+		Params.NegativeEdge = Forward2D.RotateAngleAxis(-MaxAllowedAngle, FVector::UpVector);
+		Params.CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDeg));
+		Params.MaxDistance = GraspData->MaxGraspDistance;
+		Params.TargetDistance = GraspData->MaxGraspDistance * DistanceAlpha;
+		Params.bAnyAngle = GraspData->MaxGraspAngle >= 360.f;
+		Params.bDistance2D = GraspData->bGraspDistance2D;
+		Params.bValid = true;
+		return Params;
 	}
-	else
+
+	static EGraspInteractionLocationResult Solve(const FGraspableParams& Params, const FVector& InteractorLocation,
+		FVector& OutLocation)
 	{
-		// Cases 3 & 4: Out of angle. Compute which side of the cone is nearest and clamp.
-		const FVector ToInteractor = (InteractorLocation - GraspableLocation).GetSafeNormal2D();
-		const FVector Forward2D = GraspableForward.GetSafeNormal2D();
+		if (!Params.bValid)
+		{
+			OutLocation = FVector::ZeroVector;
+			return EGraspInteractionLocationResult::Failed;
+		}
+
+		const FVector Diff = InteractorLocation - Params.Location;
+		const FVector ToInteractor = Diff.GetSafeNormal2D();
+
+		const float CurrentDist = Params.bDistance2D ? Diff.Size2D() : Diff.Size();
+		const bool bInDistance = CurrentDist <= Params.MaxDistance;
+		const bool bInAngle = Params.bAnyAngle || (Params.Forward | ToInteractor) >= Params.CosHalfAngle;
 
-		float CurrentAngleSign = 1.f;
-		if (!ToInteractor.IsNearlyZero() && !Forward2D.IsNearlyZero())
+		// Case 1: Already valid
+		if (bInDistance && bInAngle)
 		{
-			CurrentAngleSign = FMath::Sign(FVector::CrossProduct(Forward2D, ToInteractor).Z);
-			if (FMath::IsNearlyZero(CurrentAngleSign))
-			{
-				CurrentAngleSign = 1.f;
-			}
+			OutLocation = InteractorLocation;
+			return EGraspInteractionLocationResult::AlreadyInRange;
+		}
+
+		// Case 2: In angle, out of distance. Move straight toward the graspable along current direction.
+		// Cases 3 & 4: Out of angle. Clamp to the nearest edge of the valid cone, counter-clockwise if ambiguous.
+		const FVector& TargetDir = bInAngle ? ToInteractor :
+			(FVector::CrossProduct(Params.Forward, ToInteractor).Z < 0.f ? Params.NegativeEdge : Params.PositiveEdge);
+
+		// If in distance: keep current distance (just fixing angle).
+		// If out of distance: use the alpha-scaled max distance.
+		const float FinalDist = bInDistance ? CurrentDist : Params.TargetDistance;
+
+		OutLocation = Params.Location + TargetDir * FinalDist;
+
+		if (Params.bDistance2D)
+		{
+			OutLocation.Z = Params.Location.Z;
 		}
 
-		// Place at the nearest cone edge, pulled inward by AngleAlpha
-		TargetDir = Forward2D.RotateAngleAxis(MaxAllowedAngle * CurrentAngleSign, FVector::UpVector);
+		return EGraspInteractionLocationResult::NeedsToMove;
+	}
+}
+
+EGraspInteractionLocationResult UGraspStatics::GetInteractionLocationForGraspable(const FVector& InteractorLocation,
+	const UPrimitiveComponent* GraspableComponent, FVector& OutLocation,
+	int32 GraspDataIndex, float AngleAlpha, float DistanceAlpha)
+{
+	const GraspInteractionLocation::FGraspableParams Params = GraspInteractionLocation::GatherParams(
+		GraspableComponent, GraspDataIndex, AngleAlpha, DistanceAlpha);
+	return GraspInteractionLocation::Solve(Params, InteractorLocation, OutLocation);
+}
+
+void UGraspStatics::GetInteractionLocationsForGraspables(const TArray<FVector>& InteractorLocations,
+	const TArray<UPrimitiveComponent*>& GraspableComponents, TArray<FVector>& OutLocations,
+	TArray<EGraspInteractionLocationResult>& OutResults,
+	int32 GraspDataIndex, float AngleAlpha, float DistanceAlpha)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetInteractionLocationsForGraspables);
+
+	const int32 NumGraspables = GraspableComponents.Num();
+	const int32 NumPairs = InteractorLocations.Num() * NumGraspables;
+	OutLocations.SetNumUninitialized(NumPairs);
+	OutResults.SetNumUninitialized(NumPairs);
+
+	TArray<GraspInteractionLocation::FGraspableParams, TInlineAllocator<32>> Params;
+	Params.Reserve(NumGraspables);
+	for (const UPrimitiveComponent* GraspableComponent : GraspableComponents)
+	{
+		Params.Add(GraspInteractionLocation::GatherParams(GraspableComponent, GraspDataIndex, AngleAlpha, DistanceAlpha));
+	}
+
+	for (int32 i = 0; i < InteractorLocations.Num(); i++)
+	{
+		const int32 RowStart = i * NumGraspables;
+		for (int32 j = 0; j < NumGraspables; j++)
+		{
+			OutResults[RowStart + j] = GraspInteractionLocation::Solve(Params[j], InteractorLocations[i], OutLocations[RowStart + j]);
+		}
 	}
+}
 
-	// Determine the target distance.
-	// If in distance: keep current distance (just fixing angle).
-	// If out of distance: use the alpha-scaled max distance.
-	const float FinalDist = bInDistance ? CurrentDist : TargetDistance;
+void UGraspStatics::GetCheapestInteractionLocations(const TArray<FVector>& InteractorLocations,
+	const TArray<UPrimitiveComponent*>& GraspableComponents, TArray<int32>& OutGraspableIndices,
+	TArray<FVector>& OutLocations, TArray<EGraspInteractionLocationResult>& OutResults,
+	int32 GraspDataIndex, float AngleAlpha, float DistanceAlpha)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetCheapestInteractionLocations);
 
-	OutLocation = GraspableLocation + TargetDir * FinalDist;
+	const int32 NumInteractors = InteractorLocations.Num();
+	OutGraspableIndices.Init(INDEX_NONE, NumInteractors);
+	OutLocations.Init(FVector::ZeroVector, NumInteractors);
+	OutResults.Init(EGraspInteractionLocationResult::Failed, NumInteractors);
 
-	if (GraspData->bGraspDistance2D)
+	TArray<GraspInteractionLocation::FGraspableParams, TInlineAllocator<32>> Params;
+	Params.Reserve(GraspableComponents.Num());
+	for (const UPrimitiveComponent* GraspableComponent : GraspableComponents)
 	{
-		OutLocation.Z = GraspableLocation.Z;
+		Params.Add(GraspInteractionLocation::GatherParams(GraspableComponent, GraspDataIndex, AngleAlpha, DistanceAlpha));
 	}
 
-	return EGraspInteractionLocationResult::NeedsToMove;
+	for (int32 i = 0; i < NumInteractors; i++)
+	{
+		const FVector& InteractorLocation = InteractorLocations[i];
+		double BestCost = TNumericLimits<double>::Max();
+		for (int32 j = 0; j < Params.Num(); j++)
+		{
+			FVector Location;
+			const EGraspInteractionLocationResult Result = GraspInteractionLocation::Solve(Params[j], InteractorLocation, Location);
+			if (Result == EGraspInteractionLocationResult::Failed)
+			{
+				continue;
+			}
+
+			const double Cost = Result == EGraspInteractionLocationResult::AlreadyInRange ? 0.0 :
+				FVector::DistSquared(InteractorLocation, Location);
+			if (Cost < BestCost)
+			{
+				BestCost = Cost;
+				OutGraspableIndices[i] = j;
+				OutLocations[i] = Location;
+				OutResults[i] = Result;
+
+				// Nothing is cheaper than already being in range
+				if (Cost <= 0.0)
+				{
+					break;
+				}
+			}
+		}
+	}
 }
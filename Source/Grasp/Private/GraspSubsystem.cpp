@@ -4,15 +4,23 @@
 #include "GraspableComponent.h"
 #include "GraspData.h"
 #include "GraspDeveloper.h"
+#include "GraspLevelIndex.h"
+#include "GraspScanTask.h"
+#include "GraspStatics.h"
 #include "GraspTypes.h"
 #include "Abilities/GameplayAbility.h"
+#include "Async/ParallelFor.h"
 #include "CollisionQueryParams.h"
 #include "Components/PrimitiveComponent.h"
 #include "DrawDebugHelpers.h"
 #include "Engine/OverlapResult.h"
+#include "Engine/Level.h"
 #include "Engine/World.h"
+#include "NavigationSystem.h"
+#include "TimerManager.h"
 #include "TargetingSystem/TargetingSubsystem.h"
 #include "Types/TargetingSystemTypes.h"
+#include "Tasks/RootMotionSource_GraspFaceTowards.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspSubsystem)
 
@@ -27,6 +35,54 @@ namespace FGraspCVars
 		TEXT("0: Disable, 1: Draw query volume, 2: Draw query volume + result locations"),
 		ECVF_Default);
 #endif
+
+	static int32 FindGraspablesParallelThreshold = 128;
+	FAutoConsoleVariableRef CVarFindGraspablesParallelThreshold(
+		TEXT("p.Grasp.FindGraspables.ParallelThreshold"),
+		FindGraspablesParallelThreshold,
+		TEXT("Number of GraspData entries required before FindGraspables filters them across worker threads.\n")
+		TEXT("Dead and ability checks always run on the game thread, only the data checks are parallelized.\n")
+		TEXT("0: Never filter in parallel"),
+		ECVF_Default);
+
+	static int32 FindGraspablesParallelBatchSize = 32;
+	FAutoConsoleVariableRef CVarFindGraspablesParallelBatchSize(
+		TEXT("p.Grasp.FindGraspables.ParallelBatchSize"),
+		FindGraspablesParallelBatchSize,
+		TEXT("Minimum number of GraspData entries evaluated by each worker when FindGraspables filters in parallel"),
+		ECVF_Default);
+
+	static float ScanWatchdogInterval = 0.5f;
+	FAutoConsoleVariableRef CVarScanWatchdogInterval(
+		TEXT("p.Grasp.Scan.WatchdogInterval"),
+		ScanWatchdogInterval,
+		TEXT("How often the subsystem checks registered Grasp Scan Tasks for hung targeting requests.\n")
+		TEXT("Takes effect the next time the watchdog starts"),
+		ECVF_Default);
+
+	static int32 FaceTowardsPoolSize = 32;
+	FAutoConsoleVariableRef CVarFaceTowardsPoolSize(
+		TEXT("p.Grasp.FaceTowards.PoolSize"),
+		FaceTowardsPoolSize,
+		TEXT("Maximum number of face towards root motion sources kept for reuse, per world.\n")
+		TEXT("0: Allocate a new root motion source every time"),
+		ECVF_Default);
+}
+
+/** Components also unregister when re-registered or streamed out, which shouldn't drop state held for them */
+static bool IsGraspableBeingDestroyed(const UPrimitiveComponent* Component)
+{
+	const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	return !IsValid(Component) || Component->IsBeingDestroyed() || (Owner && Owner->IsActorBeingDestroyed());
+}
+
+static FIntVector GetStandingQueryCell(const FVector& Location, float CellSize)
+{
+	const double InvCellSize = 1.0 / FMath::Max(CellSize, 1.f);
+	return FIntVector(
+		FMath::FloorToInt32(Location.X * InvCellSize),
+		FMath::FloorToInt32(Location.Y * InvCellSize),
+		FMath::FloorToInt32(Location.Z * InvCellSize));
 }
 
 UGraspSubsystem* UGraspSubsystem::Get(const UObject* WorldContextObject)
@@ -57,60 +113,112 @@ static FCollisionObjectQueryParams GetGraspCollisionQueryParams()
 	return ObjectParams;
 }
 
-static bool PassesFilter(const IGraspableComponent* Graspable, const UGraspData* GraspData, const FGraspRequestFilter& Filter)
+/** @return True if the filter excludes fully reserved graspables and this entry is one */
+static bool IsExcludedByReservation(const UGraspSubsystem* Subsystem, const UPrimitiveComponent* Component,
+	const UGraspData* GraspData, int32 GraspDataIndex, const FGraspRequestFilter& Filter)
+{
+	return Filter.bExcludeFullyReserved && Subsystem && GraspData->MaxConcurrentInteractors > 0 &&
+		Subsystem->IsGraspableFullyReserved(Component, GraspDataIndex, Filter.Claimant);
+}
+
+static bool PassesFilter(const UPrimitiveComponent* Component, const IGraspableComponent* Graspable, const UGraspData* GraspData,
+	int32 GraspDataIndex, const FGraspRequestFilter& Filter, FGraspRequestFilterMatcher& Matcher)
 {
 	if (!GraspData)
 	{
 		return false;
 	}
 
-	if (!Filter.bIncludeDead && Graspable->IsGraspableDead())
+	if (IsExcludedByReservation(UGraspSubsystem::Get(Component), Component, GraspData, GraspDataIndex, Filter))
 	{
 		return false;
 	}
 
-	if (!Filter.bIncludeWithoutAbility && !GraspData->GetGraspAbility())
+	if (!Filter.bIncludeDead && Graspable->IsGraspableDead())
 	{
 		return false;
 	}
 
-	if (Filter.GraspDataClass && !GraspData->IsA(Filter.GraspDataClass))
+	if (!Filter.bIncludeWithoutAbility && !GraspData->GetGraspAbility())
 	{
 		return false;
 	}
 
-	if (!Filter.TagRequirements.IsEmpty() && GraspData->InputTag.IsValid())
+	Matcher.Compile(GraspData);
+	return Matcher.Matches(GraspData);
+}
+
+static void GatherGraspablesOnActor(AActor* Actor, const FGraspRequestFilter& Filter, FGraspRequestFilterMatcher& Matcher,
+	TArray<FGraspRequestResult>& OutResults)
+{
+	TArray<UPrimitiveComponent*> Components;
+	Actor->GetComponents<UPrimitiveComponent>(Components);
+
+	for (UPrimitiveComponent* Component : Components)
 	{
-		FGameplayTagContainer Tags;
-		Tags.AddTag(GraspData->InputTag);
-		if (!Filter.TagRequirements.Matches(Tags))
+		IGraspableComponent* Graspable = Cast<IGraspableComponent>(Component);
+		if (!Graspable)
 		{
-			return false;
+			continue;
 		}
-	}
-	else if (!Filter.TagRequirements.IsEmpty() && !GraspData->InputTag.IsValid())
-	{
-		// Filter requires tags but this GraspData has no InputTag
-		return false;
-	}
 
-	return true;
+		const int32 NumGraspData = Graspable->GetNumGraspData();
+		for (int32 Index = 0; Index < NumGraspData; ++Index)
+		{
+			const UGraspData* GraspData = Graspable->GetGraspData(Index);
+			if (PassesFilter(Component, Graspable, GraspData, Index, Filter, Matcher))
+			{
+				OutResults.Emplace(Component, Index, 0.f);
+			}
+		}
+	}
 }
 
-static void FilterOverlapResults(
-	const TArray<FOverlapResult>& OverlapResults,
+/**
+ * A single GraspData entry gathered from an overlapped component on the game thread
+ * Everything that requires calling into the component or the GraspData's native events is resolved up front
+ */
+struct FGraspFilterCandidate
+{
+	UPrimitiveComponent* Component = nullptr;
+	const UGraspData* GraspData = nullptr;
+	FVector Location = FVector::ZeroVector;
+	int32 GraspDataIndex = INDEX_NONE;
+};
+
+/** Per-thread output of the parallel data pass */
+struct FGraspFilterTaskContext
+{
+	TArray<int32> PassedCandidates;
+};
+
+/**
+ * Game thread pass: resolve components, interfaces, dead state and abilities, and compile the filter's tag query
+ * Entries that fail these checks never reach the data pass
+ */
+static void GatherFilterCandidates(
+	TConstArrayView<UPrimitiveComponent*> Components,
 	const FGraspRequestFilter& Filter,
-	const FVector& QueryOrigin,
-	TArray<FGraspRequestResult>& OutResults)
+	FGraspRequestFilterMatcher& Matcher,
+	TArray<FGraspFilterCandidate>& OutCandidates)
 {
-	for (const FOverlapResult& Overlap : OverlapResults)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::GatherFilterCandidates);
+
+	OutCandidates.Reserve(Components.Num());
+
+	const UGraspSubsystem* Subsystem = nullptr;
+	for (UPrimitiveComponent* Component : Components)
 	{
-		UPrimitiveComponent* Component = Overlap.GetComponent();
 		if (!Component || !Component->GetOwner())
 		{
 			continue;
 		}
 
+		if (Filter.bExcludeFullyReserved && !Subsystem)
+		{
+			Subsystem = UGraspSubsystem::Get(Component);
+		}
+
 		if (Component->GetOwner()->IsPendingKillPending())
 		{
 			continue;
@@ -122,18 +230,123 @@ static void FilterOverlapResults(
 			continue;
 		}
 
+		if (!Filter.bIncludeDead && Graspable->IsGraspableDead())
+		{
+			continue;
+		}
+
+		const FVector Location = Component->GetComponentLocation();
 		const int32 NumGraspData = Graspable->GetNumGraspData();
 		for (int32 Index = 0; Index < NumGraspData; ++Index)
 		{
 			const UGraspData* GraspData = Graspable->GetGraspData(Index);
-			if (PassesFilter(Graspable, GraspData, Filter))
+			if (!GraspData)
+			{
+				continue;
+			}
+
+			// GetGraspAbility() is a BlueprintNativeEvent, it cannot be called from a worker thread
+			if (!Filter.bIncludeWithoutAbility && !GraspData->GetGraspAbility())
+			{
+				continue;
+			}
+
+			// Reservations are only modified on the game thread
+			if (IsExcludedByReservation(Subsystem, Component, GraspData, Index, Filter))
+			{
+				continue;
+			}
+
+			// Resolve the tag query here so the data pass only reads cached results
+			Matcher.Compile(GraspData);
+
+			FGraspFilterCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+			Candidate.Component = Component;
+			Candidate.GraspData = GraspData;
+			Candidate.Location = Location;
+			Candidate.GraspDataIndex = Index;
+		}
+	}
+}
+
+static void FilterGraspableComponents(
+	TConstArrayView<UPrimitiveComponent*> Components,
+	const FGraspRequestFilter& Filter,
+	const FVector& QueryOrigin,
+	TArray<FGraspRequestResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::FilterGraspableComponents);
+
+	FGraspRequestFilterMatcher Matcher(Filter);
+
+	TArray<FGraspFilterCandidate> Candidates;
+	GatherFilterCandidates(Components, Filter, Matcher, Candidates);
+
+	const int32 NumCandidates = Candidates.Num();
+	if (NumCandidates == 0)
+	{
+		return;
+	}
+
+	// Distances are written by candidate index, so threads never write to the same element
+	TArray<float> Distances;
+	Distances.SetNumUninitialized(NumCandidates);
+
+	auto EvaluateCandidate = [&Candidates, &Distances, &Matcher, &QueryOrigin](int32 CandidateIndex)
+	{
+		const FGraspFilterCandidate& Candidate = Candidates[CandidateIndex];
+		if (!Matcher.Matches(Candidate.GraspData))
+		{
+			return false;
+		}
+		Distances[CandidateIndex] = FVector::Dist(QueryOrigin, Candidate.Location);
+		return true;
+	};
+
+	TArray<int32> PassedCandidates;
+	PassedCandidates.Reserve(NumCandidates);
+
+	const int32 ParallelThreshold = FGraspCVars::FindGraspablesParallelThreshold;
+	if (ParallelThreshold > 0 && NumCandidates >= ParallelThreshold)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::FilterGraspableComponents_Parallel);
+
+		TArray<FGraspFilterTaskContext> TaskContexts;
+		ParallelForWithTaskContext(TEXT("GraspFilterGraspableComponents"), TaskContexts, NumCandidates,
+			FGraspCVars::FindGraspablesParallelBatchSize,
+			[&EvaluateCandidate](FGraspFilterTaskContext& Context, int32 CandidateIndex)
 			{
-				const float Distance = FVector::Dist(QueryOrigin, Component->GetComponentLocation());
-				OutResults.Emplace(Component, Index, Distance);
+				if (EvaluateCandidate(CandidateIndex))
+				{
+					Context.PassedCandidates.Add(CandidateIndex);
+				}
+			});
+
+		// Merge the per-thread buffers, then restore the overlap order so results are deterministic
+		for (const FGraspFilterTaskContext& Context : TaskContexts)
+		{
+			PassedCandidates.Append(Context.PassedCandidates);
+		}
+		PassedCandidates.Sort();
+	}
+	else
+	{
+		for (int32 CandidateIndex = 0; CandidateIndex < NumCandidates; ++CandidateIndex)
+		{
+			if (EvaluateCandidate(CandidateIndex))
+			{
+				PassedCandidates.Add(CandidateIndex);
 			}
 		}
 	}
 
+	OutResults.Reserve(OutResults.Num() + PassedCandidates.Num());
+	for (const int32 CandidateIndex : PassedCandidates)
+	{
+		const FGraspFilterCandidate& Candidate = Candidates[CandidateIndex];
+		OutResults.Emplace(Candidate.Component, Candidate.GraspDataIndex, Distances[CandidateIndex]);
+	}
+
 	// Sort by distance
 	OutResults.Sort([](const FGraspRequestResult& A, const FGraspRequestResult& B)
 	{
@@ -165,41 +378,58 @@ bool UGraspSubsystem::FindGraspables(const UObject* WorldContextObject, const FG
 
 	OutResults.Reset();
 
-	const FCollisionObjectQueryParams ObjectParams = GetGraspCollisionQueryParams();
-	FCollisionQueryParams QueryParams;
-	QueryParams.bReturnPhysicalMaterial = false;
-
-	TArray<FOverlapResult> OverlapResults;
+	const FVector QueryOrigin = Request.bUseSphere ? Request.QuerySphereCenter : Request.QueryBox.GetCenter();
 
-	if (Request.bUseSphere)
+	TArray<UPrimitiveComponent*> Components;
+	if (Request.bUseGraspableIndex)
 	{
-		const FCollisionShape Shape = FCollisionShape::MakeSphere(Request.QuerySphereRadius);
-		World->OverlapMultiByObjectType(OverlapResults, Request.QuerySphereCenter, FQuat::Identity, ObjectParams, Shape, QueryParams);
-		FilterOverlapResults(OverlapResults, Request.Filter, Request.QuerySphereCenter, OutResults);
-
-#if UE_ENABLE_DEBUG_DRAWING
-		if (FGraspCVars::FindGraspablesDebug >= 1)
+		if (const UGraspSubsystem* Subsystem = World->GetSubsystem<UGraspSubsystem>())
 		{
-			DrawDebugSphere(World, Request.QuerySphereCenter, Request.QuerySphereRadius, 16,
-				OutResults.Num() > 0 ? FColor::Green : FColor::Red, false, 0.5f);
+			if (Request.bUseSphere)
+			{
+				Subsystem->QueryGraspableIndex(Request.QuerySphereCenter, Request.QuerySphereRadius, Components);
+			}
+			else
+			{
+				Subsystem->QueryGraspableIndex(Request.QueryBox, Components);
+			}
 		}
-#endif
 	}
 	else
 	{
-		const FVector Center = Request.QueryBox.GetCenter();
-		const FVector Extent = Request.QueryBox.GetExtent();
-		const FCollisionShape Shape = FCollisionShape::MakeBox(Extent);
-		World->OverlapMultiByObjectType(OverlapResults, Center, FQuat::Identity, ObjectParams, Shape, QueryParams);
-		FilterOverlapResults(OverlapResults, Request.Filter, Center, OutResults);
+		const FCollisionObjectQueryParams ObjectParams = GetGraspCollisionQueryParams();
+		FCollisionQueryParams QueryParams;
+		QueryParams.bReturnPhysicalMaterial = false;
+
+		const FCollisionShape Shape = Request.bUseSphere ? FCollisionShape::MakeSphere(Request.QuerySphereRadius) :
+			FCollisionShape::MakeBox(Request.QueryBox.GetExtent());
+
+		TArray<FOverlapResult> OverlapResults;
+		World->OverlapMultiByObjectType(OverlapResults, QueryOrigin, FQuat::Identity, ObjectParams, Shape, QueryParams);
+
+		Components.Reserve(OverlapResults.Num());
+		for (const FOverlapResult& Overlap : OverlapResults)
+		{
+			Components.Add(Overlap.GetComponent());
+		}
+	}
+
+	FilterGraspableComponents(Components, Request.Filter, QueryOrigin, OutResults);
 
 #if UE_ENABLE_DEBUG_DRAWING
-		if (FGraspCVars::FindGraspablesDebug >= 1)
+	if (FGraspCVars::FindGraspablesDebug >= 1)
+	{
+		const FColor Color = OutResults.Num() > 0 ? FColor::Green : FColor::Red;
+		if (Request.bUseSphere)
 		{
-			DrawDebugBox(World, Center, Extent, OutResults.Num() > 0 ? FColor::Green : FColor::Red, false, 0.5f);
+			DrawDebugSphere(World, Request.QuerySphereCenter, Request.QuerySphereRadius, 16, Color, false, 0.5f);
+		}
+		else
+		{
+			DrawDebugBox(World, QueryOrigin, Request.QueryBox.GetExtent(), Color, false, 0.5f);
 		}
-#endif
 	}
+#endif
 
 #if UE_ENABLE_DEBUG_DRAWING
 	if (FGraspCVars::FindGraspablesDebug >= 2)
@@ -226,6 +456,9 @@ bool UGraspSubsystem::FindGraspablesInList(const UObject* WorldContextObject, co
 
 	OutResults.Reset();
 
+	// Compiled once and shared across every actor in the list
+	FGraspRequestFilterMatcher Matcher(Filter);
+
 	for (AActor* Actor : ActorList)
 	{
 		if (!Actor || Actor->IsPendingKillPending())
@@ -233,11 +466,7 @@ bool UGraspSubsystem::FindGraspablesInList(const UObject* WorldContextObject, co
 			continue;
 		}
 
-		TArray<FGraspRequestResult> ActorResults;
-		if (FindGraspablesOnActor(Actor, Filter, ActorResults))
-		{
-			OutResults.Append(ActorResults);
-		}
+		GatherGraspablesOnActor(Actor, Filter, Matcher, OutResults);
 	}
 
 	return OutResults.Num() > 0;
@@ -272,27 +501,1067 @@ bool UGraspSubsystem::FindGraspablesOnActor(AActor* Actor, const FGraspRequestFi
 		return false;
 	}
 
-	TArray<UPrimitiveComponent*> Components;
-	Actor->GetComponents<UPrimitiveComponent>(Components);
+	FGraspRequestFilterMatcher Matcher(Filter);
+	GatherGraspablesOnActor(Actor, Filter, Matcher, OutResults);
 
-	for (UPrimitiveComponent* Component : Components)
+	return OutResults.Num() > 0;
+}
+
+void UGraspSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAddedToWorld);
+	LevelRemovedFromWorldHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &ThisClass::OnLevelRemovedFromWorld);
+
+	// Attach the persistent level's baked index before any components register, so queries work from the first frame
+	const UWorld* World = GetWorld();
+	if (World && World->IsGameWorld() && World->PersistentLevel)
 	{
-		IGraspableComponent* Graspable = Cast<IGraspableComponent>(Component);
-		if (!Graspable)
+		FindOrAddChunk(World->PersistentLevel);
+	}
+}
+
+void UGraspSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Navigation is created after subsystems initialize
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &ThisClass::OnNavigationGenerationFinished);
+	}
+}
+
+void UGraspSubsystem::Deinitialize()
+{
+	StandingQueries.Empty();
+	InteractionSlots.Empty();
+	Reservations.Empty();
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveAll(this);
+	}
+
+	Scanners.Empty();
+	FaceTowardsPool.Empty();
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ScanWatchdogTimer);
+	}
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedFromWorldHandle);
+	for (const TPair<TObjectKey<UPrimitiveComponent>, TObjectKey<ULevel>>& Indexed : IndexedComponentLevels)
+	{
+		if (UPrimitiveComponent* Component = Indexed.Key.ResolveObjectPtr())
+		{
+			Component->TransformUpdated.RemoveAll(this);
+		}
+	}
+	IndexedComponentLevels.Empty();
+	IndexChunks.Empty();
+
+	Super::Deinitialize();
+}
+
+void UGraspSubsystem::RegisterScanner(UGraspScanTask* Scanner)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::RegisterScanner);
+
+	const UWorld* World = GetWorld();
+	if (!IsValid(Scanner) || !World)
+	{
+		return;
+	}
+
+	Scanners.AddUnique(Scanner);
+
+	if (!World->GetTimerManager().IsTimerActive(ScanWatchdogTimer))
+	{
+		const float Interval = FMath::Max(FGraspCVars::ScanWatchdogInterval, 0.05f);
+		World->GetTimerManager().SetTimer(ScanWatchdogTimer, this, &ThisClass::OnScanWatchdog, Interval, true);
+	}
+}
+
+void UGraspSubsystem::UnregisterScanner(UGraspScanTask* Scanner)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::UnregisterScanner);
+
+	Scanners.RemoveSingleSwap(Scanner);
+
+	if (Scanners.Num() == 0)
+	{
+		if (const UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(ScanWatchdogTimer);
+		}
+	}
+}
+
+TSharedPtr<FRootMotionSource_GraspFaceTowards> UGraspSubsystem::AcquireFaceTowardsRootMotionSource()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::AcquireFaceTowardsRootMotionSource);
+
+	// Sources are shared with the movement component while applied, only the pool holds finished ones
+	for (const TSharedPtr<FRootMotionSource_GraspFaceTowards>& Pooled : FaceTowardsPool)
+	{
+		if (Pooled.GetSharedReferenceCount() == 1)
+		{
+			*Pooled = FRootMotionSource_GraspFaceTowards();
+			return Pooled;
+		}
+	}
+
+	TSharedPtr<FRootMotionSource_GraspFaceTowards> Source = MakeShared<FRootMotionSource_GraspFaceTowards>();
+	if (FaceTowardsPool.Num() < FGraspCVars::FaceTowardsPoolSize)
+	{
+		FaceTowardsPool.Add(Source);
+	}
+	return Source;
+}
+
+void UGraspSubsystem::OnScanWatchdog()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::OnScanWatchdog);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double TimeSeconds = World->GetTimeSeconds();
+
+	// Iterate backwards so stale scanners can be removed in place
+	for (int32 i = Scanners.Num() - 1; i >= 0; --i)
+	{
+		UGraspScanTask* Scanner = Scanners[i].Get();
+		if (!Scanner)
 		{
+			Scanners.RemoveAtSwap(i);
 			continue;
 		}
+		Scanner->RetryIfHung(TimeSeconds);
+	}
 
-		const int32 NumGraspData = Graspable->GetNumGraspData();
-		for (int32 Index = 0; Index < NumGraspData; ++Index)
+	if (Scanners.Num() == 0)
+	{
+		World->GetTimerManager().ClearTimer(ScanWatchdogTimer);
+	}
+}
+
+TStatId UGraspSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGraspSubsystem, STATGROUP_Tickables);
+}
+
+void UGraspSubsystem::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::Tick);
+
+	Super::Tick(DeltaTime);
+
+	const double TimeSeconds = GetWorld()->GetTimeSeconds();
+
+	// Delegates can register or unregister queries, so iterate a copy of the handles
+	TArray<FGraspStandingQueryHandle> Handles;
+	StandingQueries.GetKeys(Handles);
+
+	for (const FGraspStandingQueryHandle& Handle : Handles)
+	{
+		FGraspStandingQuery* Query = StandingQueries.Find(Handle);
+		if (!Query)
 		{
-			const UGraspData* GraspData = Graspable->GetGraspData(Index);
-			if (PassesFilter(Graspable, GraspData, Filter))
+			continue;
+		}
+
+		// Follow actor was destroyed, report everything as exited and stop tracking
+		const AActor* FollowActor = Query->FollowActor.Get();
+		if (!FollowActor || FollowActor->IsPendingKillPending())
+		{
+			const TArray<FGraspRequestResult> Exited = MoveTemp(Query->Results);
+			const FGraspStandingQueryDelegates Delegates = Query->Delegates;
+			StandingQueries.Remove(Handle);
+
+			for (const FGraspRequestResult& Result : Exited)
 			{
-				OutResults.Emplace(Component, Index, 0.f);
+				Delegates.OnExit.ExecuteIfBound(Handle, Result);
+			}
+			if (Exited.Num() > 0)
+			{
+				Delegates.OnChanged.ExecuteIfBound(Handle, {});
+				Delegates.OnChangedDynamic.ExecuteIfBound(Handle, {}, Exited);
 			}
+			continue;
+		}
+
+		if (TimeSeconds - Query->LastUpdateTime < Query->StandingRequest.UpdateInterval)
+		{
+			continue;
+		}
+		Query->LastUpdateTime = TimeSeconds;
+
+		const FVector FollowLocation = FollowActor->GetActorLocation();
+		const FIntVector FollowCell = GetStandingQueryCell(FollowLocation, Query->StandingRequest.CellSize);
+		if (ShouldRefreshStandingQuery(*Query, FollowCell, TimeSeconds))
+		{
+			RefreshStandingQuery(Handle, *Query, FollowLocation, FollowCell, TimeSeconds);
 		}
 	}
+}
 
-	return OutResults.Num() > 0;
+FGraspStandingQueryHandle UGraspSubsystem::RegisterStandingQuery(const FGraspStandingRequest& StandingRequest,
+	const AActor* FollowActor, const FGraspStandingQueryDelegates& Delegates)
+{
+	if (!FollowActor)
+	{
+		UE_LOG(LogGrasp, Warning, TEXT("UGraspSubsystem: Standing query requires a valid FollowActor"));
+		return {};
+	}
+
+	const FGraspStandingQueryHandle Handle { ++LastStandingQueryHandle };
+
+	FGraspStandingQuery& Query = StandingQueries.Add(Handle);
+	Query.StandingRequest = StandingRequest;
+	Query.FollowActor = FollowActor;
+	Query.Delegates = Delegates;
+
+	return Handle;
+}
+
+FGraspStandingQueryHandle UGraspSubsystem::K2_RegisterStandingQuery(const FGraspStandingRequest& StandingRequest,
+	const AActor* FollowActor, FOnGraspStandingQueryChanged OnChanged)
+{
+	FGraspStandingQueryDelegates Delegates;
+	Delegates.OnChangedDynamic = OnChanged;
+	return RegisterStandingQuery(StandingRequest, FollowActor, Delegates);
+}
+
+bool UGraspSubsystem::UnregisterStandingQuery(FGraspStandingQueryHandle& Handle)
+{
+	const bool bRemoved = StandingQueries.Remove(Handle) > 0;
+	Handle.Invalidate();
+	return bRemoved;
+}
+
+bool UGraspSubsystem::GetStandingQueryResults(FGraspStandingQueryHandle Handle, TArray<FGraspRequestResult>& OutResults) const
+{
+	if (const FGraspStandingQuery* Query = StandingQueries.Find(Handle))
+	{
+		OutResults = Query->Results;
+		return true;
+	}
+	OutResults.Reset();
+	return false;
+}
+
+bool UGraspSubsystem::ShouldRefreshStandingQuery(const FGraspStandingQuery& Query, const FIntVector& FollowCell,
+	double TimeSeconds) const
+{
+	if (!Query.bHasRefreshed || Query.bDirty || Query.FollowCell != FollowCell)
+	{
+		return true;
+	}
+
+	const float MaxRefreshInterval = Query.StandingRequest.MaxRefreshInterval;
+	if (MaxRefreshInterval > 0.f && TimeSeconds - Query.LastRefreshTime >= MaxRefreshInterval)
+	{
+		return true;
+	}
+
+	// Any result that was destroyed or moved across a cell
+	for (int32 Index = 0; Index < Query.Results.Num(); ++Index)
+	{
+		const UPrimitiveComponent* Component = Query.Results[Index].GraspableComponent.Get();
+		if (!Component)
+		{
+			return true;
+		}
+
+		const FIntVector Cell = GetStandingQueryCell(Component->GetComponentLocation(), Query.StandingRequest.CellSize);
+		if (Cell != Query.ResultCells[Index])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UGraspSubsystem::MarkStandingQueriesDirty(const FBox& Bounds, const UPrimitiveComponent* Component)
+{
+	for (TPair<FGraspStandingQueryHandle, FGraspStandingQuery>& Entry : StandingQueries)
+	{
+		FGraspStandingQuery& Query = Entry.Value;
+		if (Query.bDirty || !Query.bHasRefreshed || !Query.QueryBounds.Intersect(Bounds))
+		{
+			continue;
+		}
+
+		// Results that move are already tracked by their cell
+		const bool bIsResult = Component && Query.Results.ContainsByPredicate([Component](const FGraspRequestResult& Result)
+		{
+			return Result.GraspableComponent.Get() == Component;
+		});
+		Query.bDirty = !bIsResult;
+	}
+}
+
+void UGraspSubsystem::RefreshStandingQuery(FGraspStandingQueryHandle Handle, FGraspStandingQuery& Query,
+	const FVector& FollowLocation, const FIntVector& FollowCell, double TimeSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::RefreshStandingQuery);
+
+	// Move the query volume to the follow actor
+	FGraspRequest Request = Query.StandingRequest.Request;
+	Request.QuerySphereCenter += FollowLocation;
+	Request.QueryBox = Request.QueryBox.ShiftBy(FollowLocation);
+
+	TArray<FGraspRequestResult> Results;
+	FindGraspables(this, Request, Results);
+
+	TArray<FGraspRequestResult> Entered;
+	TArray<FGraspRequestResult> Exited;
+
+	for (const FGraspRequestResult& Result : Results)
+	{
+		if (!Query.Results.Contains(Result))
+		{
+			Entered.Add(Result);
+		}
+	}
+
+	for (const FGraspRequestResult& Result : Query.Results)
+	{
+		if (!Result.IsValid() || !Results.Contains(Result))
+		{
+			Exited.Add(Result);
+		}
+	}
+
+	Query.ResultCells.Reset(Results.Num());
+	for (const FGraspRequestResult& Result : Results)
+	{
+		const UPrimitiveComponent* Component = Result.GraspableComponent.Get();
+		Query.ResultCells.Add(GetStandingQueryCell(Component->GetComponentLocation(), Query.StandingRequest.CellSize));
+	}
+
+	Query.Results = Results;
+	Query.FollowCell = FollowCell;
+	Query.QueryBounds = Request.bUseSphere ? FBox::BuildAABB(Request.QuerySphereCenter, FVector(Request.QuerySphereRadius)) :
+		Request.QueryBox;
+	Query.LastRefreshTime = TimeSeconds;
+	Query.bHasRefreshed = true;
+	Query.bDirty = false;
+
+	if (Entered.Num() == 0 && Exited.Num() == 0)
+	{
+		return;
+	}
+
+	// Delegates may unregister this query, don't touch Query after this point
+	const FGraspStandingQueryDelegates Delegates = Query.Delegates;
+
+	for (const FGraspRequestResult& Result : Exited)
+	{
+		Delegates.OnExit.ExecuteIfBound(Handle, Result);
+	}
+
+	for (const FGraspRequestResult& Result : Entered)
+	{
+		Delegates.OnEnter.ExecuteIfBound(Handle, Result);
+	}
+
+	Delegates.OnChanged.ExecuteIfBound(Handle, Results);
+	Delegates.OnChangedDynamic.ExecuteIfBound(Handle, Entered, Exited);
+}
+
+void UGraspSubsystem::FGraspIndexChunk::Add(UPrimitiveComponent* Component, const FSphere& EntryBounds)
+{
+	EntryIndices.Add(Component, Entries.Num());
+	Entries.Add({ Component, Component, EntryBounds });
+	Bounds += FBox::BuildAABB(EntryBounds.Center, FVector(EntryBounds.W));
+}
+
+void UGraspSubsystem::FGraspIndexChunk::Remove(const UPrimitiveComponent* Component)
+{
+	int32 Index;
+	if (!EntryIndices.RemoveAndCopyValue(Component, Index))
+	{
+		return;
+	}
+
+	// Swap the last entry into the removed slot
+	Entries.RemoveAtSwap(Index);
+	if (Entries.IsValidIndex(Index) && Entries[Index].BakedIndex == INDEX_NONE)
+	{
+		EntryIndices.Add(Entries[Index].Key, Index);
+	}
+}
+
+void UGraspSubsystem::FGraspIndexChunk::Update(const UPrimitiveComponent* Component, const FSphere& EntryBounds)
+{
+	if (const int32* Index = EntryIndices.Find(Component))
+	{
+		Entries[*Index].Bounds = EntryBounds;
+		Bounds += FBox::BuildAABB(EntryBounds.Center, FVector(EntryBounds.W));
+	}
+}
+
+void UGraspSubsystem::FGraspIndexChunk::AddBaked(const UGraspLevelIndex* InBakedIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::FGraspIndexChunk::AddBaked);
+
+	BakedIndex = InBakedIndex;
+
+	Entries.Reserve(Entries.Num() + InBakedIndex->Num());
+	for (int32 Index = 0; Index < InBakedIndex->Num(); ++Index)
+	{
+		const FGraspBakedEntry& Baked = InBakedIndex->Entries[Index];
+
+		FGraspIndexEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Bounds = FSphere(FVector(Baked.BoundsOrigin), Baked.BoundsRadius);
+		Entry.BakedIndex = Index;
+		Bounds += FBox::BuildAABB(Entry.Bounds.Center, FVector(Entry.Bounds.W));
+	}
+}
+
+UPrimitiveComponent* UGraspSubsystem::FGraspIndexChunk::Resolve(const FGraspIndexEntry& Entry) const
+{
+	if (UPrimitiveComponent* Component = Entry.Component.Get())
+	{
+		return Component;
+	}
+
+	if (Entry.BakedIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const UGraspLevelIndex* Baked = BakedIndex.Get();
+	UPrimitiveComponent* Component = Baked ? Baked->ResolveComponent(Level.Get(), Entry.BakedIndex) : nullptr;
+	Entry.Component = Component;
+	return Component;
+}
+
+static FSphere GetGraspableIndexBounds(const UPrimitiveComponent* Component)
+{
+	return FSphere(Component->Bounds.Origin, Component->Bounds.SphereRadius);
+}
+
+void UGraspSubsystem::RegisterGraspable(UPrimitiveComponent* Component)
+{
+	const UWorld* World = Component ? Component->GetWorld() : nullptr;
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	if (UGraspSubsystem* Subsystem = World->GetSubsystem<UGraspSubsystem>())
+	{
+		Subsystem->AddToIndex(Component);
+
+		if (GetDefault<UGraspDeveloper>()->bBuildInteractionSlotsOnRegister)
+		{
+			const int32 NumGraspData = UGraspStatics::GetGraspDataEntries(Component).Num();
+			for (int32 i = 0; i < NumGraspData; i++)
+			{
+				Subsystem->FindOrBuildInteractionSlots(Component, i);
+			}
+		}
+	}
+}
+
+void UGraspSubsystem::UnregisterGraspable(UPrimitiveComponent* Component)
+{
+	const UWorld* World = Component ? Component->GetWorld() : nullptr;
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	if (UGraspSubsystem* Subsystem = World->GetSubsystem<UGraspSubsystem>())
+	{
+		Subsystem->RemoveFromIndex(Component);
+		if (IsGraspableBeingDestroyed(Component))
+		{
+			Subsystem->InteractionSlots.Remove(Component);
+			Subsystem->Reservations.Remove(Component);
+		}
+		Subsystem->OnGraspableUnregistered.Broadcast(Component);
+	}
+}
+
+void UGraspSubsystem::AddToIndex(UPrimitiveComponent* Component)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::AddToIndex);
+
+	ULevel* Level = Component->GetComponentLevel();
+	if (!Level || IndexedComponentLevels.Contains(Component))
+	{
+		return;
+	}
+
+	FGraspIndexChunk& Chunk = FindOrAddChunk(Level);
+
+	// Static graspables loaded with a baked level are already in the chunk
+	if (Chunk.BakedIndex.IsValid() && Component->Mobility == EComponentMobility::Static && Component->HasAnyFlags(RF_WasLoaded))
+	{
+		if (Chunk.BakedIndex->FindEntry(Component) != INDEX_NONE)
+		{
+			return;
+		}
+
+		// Added to the level after it was baked, register it at runtime instead
+		if (!Chunk.bWarnedStaleBake)
+		{
+			Chunk.bWarnedStaleBake = true;
+			UE_LOG(LogGrasp, Warning,
+				TEXT("UGraspSubsystem: %s is not in the baked graspable index for %s, run GraspBakeIndex to rebake the level"),
+				*GetPathNameSafe(Component), *GetNameSafe(Level->GetOutermost()));
+		}
+	}
+
+	const FSphere Bounds = GetGraspableIndexBounds(Component);
+	Chunk.Add(Component, Bounds);
+	IndexedComponentLevels.Add(Component, Level);
+
+	// Standing queries pick up new graspables without waiting for their MaxRefreshInterval
+	MarkStandingQueriesDirty(FBox::BuildAABB(Bounds.Center, FVector(Bounds.W)), Component);
+
+	// Static graspables never move, everything else keeps its entry up to date
+	if (Component->Mobility == EComponentMobility::Movable)
+	{
+		Component->TransformUpdated.AddUObject(this, &ThisClass::OnGraspableTransformUpdated);
+	}
+}
+
+void UGraspSubsystem::RemoveFromIndex(UPrimitiveComponent* Component)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::RemoveFromIndex);
+
+	TObjectKey<ULevel> Level;
+	if (!IndexedComponentLevels.RemoveAndCopyValue(Component, Level))
+	{
+		return;
+	}
+
+	Component->TransformUpdated.RemoveAll(this);
+
+	if (FGraspIndexChunk* Chunk = IndexChunks.Find(Level))
+	{
+		Chunk->Remove(Component);
+		if (Chunk->Entries.Num() == 0 && !Chunk->BakedIndex.IsValid())
+		{
+			IndexChunks.Remove(Level);
+		}
+	}
+}
+
+void UGraspSubsystem::OnGraspableTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags,
+	ETeleportType Teleport)
+{
+	const UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(UpdatedComponent);
+	if (const TObjectKey<ULevel>* Level = Component ? IndexedComponentLevels.Find(Component) : nullptr)
+	{
+		if (FGraspIndexChunk* Chunk = IndexChunks.Find(*Level))
+		{
+			const FSphere Bounds = GetGraspableIndexBounds(Component);
+			Chunk->Update(Component, Bounds);
+			MarkStandingQueriesDirty(FBox::BuildAABB(Bounds.Center, FVector(Bounds.W)), Component);
+		}
+	}
+}
+
+UGraspSubsystem::FGraspIndexChunk& UGraspSubsystem::FindOrAddChunk(ULevel* Level)
+{
+	if (FGraspIndexChunk* Chunk = IndexChunks.Find(Level))
+	{
+		return *Chunk;
+	}
+
+	FGraspIndexChunk& Chunk = IndexChunks.Add(Level);
+	Chunk.Level = Level;
+
+	if (const UGraspLevelIndex* Baked = Level->GetAssetUserData<UGraspLevelIndex>())
+	{
+		Chunk.AddBaked(Baked);
+	}
+
+	return Chunk;
+}
+
+int32 UGraspSubsystem::GetNumIndexedGraspables() const
+{
+	int32 Num = 0;
+	for (const TPair<TObjectKey<ULevel>, FGraspIndexChunk>& Chunk : IndexChunks)
+	{
+		Num += Chunk.Value.Entries.Num();
+	}
+	return Num;
+}
+
+void UGraspSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (!Level || World != GetWorld() || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	// Baked levels may not have any components that registered, attach their chunk now
+	const FGraspIndexChunk& Chunk = FindOrAddChunk(Level);
+	if (Chunk.Bounds.IsValid)
+	{
+		MarkStandingQueriesDirty(Chunk.Bounds);
+	}
+}
+
+void UGraspSubsystem::OnLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::OnLevelRemovedFromWorld);
+
+	PruneCollectedGraspables();
+
+	// A null level means every level was removed
+	if (!Level)
+	{
+		for (const TPair<TObjectKey<UPrimitiveComponent>, TObjectKey<ULevel>>& Indexed : IndexedComponentLevels)
+		{
+			if (UPrimitiveComponent* Component = Indexed.Key.ResolveObjectPtr())
+			{
+				Component->TransformUpdated.RemoveAll(this);
+			}
+		}
+		IndexedComponentLevels.Empty();
+		IndexChunks.Empty();
+		return;
+	}
+
+	// Detach the whole chunk, only its own entries are touched
+	FGraspIndexChunk Chunk;
+	if (!IndexChunks.RemoveAndCopyValue(Level, Chunk))
+	{
+		return;
+	}
+
+	for (const FGraspIndexEntry& Entry : Chunk.Entries)
+	{
+		if (UPrimitiveComponent* Component = Entry.Component.Get())
+		{
+			Component->TransformUpdated.RemoveAll(this);
+		}
+	}
+
+	for (const TPair<TObjectKey<UPrimitiveComponent>, int32>& EntryIndex : Chunk.EntryIndices)
+	{
+		IndexedComponentLevels.Remove(EntryIndex.Key);
+	}
+}
+
+void UGraspSubsystem::PruneCollectedGraspables()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::PruneCollectedGraspables);
+
+	for (auto It = InteractionSlots.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = Reservations.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGraspSubsystem::QueryGraspableIndex(const FVector& Center, float Radius, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::QueryGraspableIndex);
+
+	const FBox QueryBounds = FBox::BuildAABB(Center, FVector(Radius));
+	for (const TPair<TObjectKey<ULevel>, FGraspIndexChunk>& Chunk : IndexChunks)
+	{
+		if (!Chunk.Value.Bounds.Intersect(QueryBounds))
+		{
+			continue;
+		}
+
+		for (const FGraspIndexEntry& Entry : Chunk.Value.Entries)
+		{
+			if (FVector::DistSquared(Center, Entry.Bounds.Center) <= FMath::Square(Radius + Entry.Bounds.W))
+			{
+				if (UPrimitiveComponent* Component = Chunk.Value.Resolve(Entry))
+				{
+					OutComponents.Add(Component);
+				}
+			}
+		}
+	}
+}
+
+void UGraspSubsystem::QueryGraspableIndex(const FBox& Box, TArray<UPrimitiveComponent*>& OutComponents) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::QueryGraspableIndex);
+
+	for (const TPair<TObjectKey<ULevel>, FGraspIndexChunk>& Chunk : IndexChunks)
+	{
+		if (!Chunk.Value.Bounds.Intersect(Box))
+		{
+			continue;
+		}
+
+		for (const FGraspIndexEntry& Entry : Chunk.Value.Entries)
+		{
+			if (Box.ComputeSquaredDistanceToPoint(Entry.Bounds.Center) <= FMath::Square(Entry.Bounds.W))
+			{
+				if (UPrimitiveComponent* Component = Chunk.Value.Resolve(Entry))
+				{
+					OutComponents.Add(Component);
+				}
+			}
+		}
+	}
+}
+
+bool UGraspSubsystem::GetInteractionSlots(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, TArray<FVector>& OutSlots)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::GetInteractionSlots);
+
+	OutSlots.Reset();
+
+	const FGraspInteractionSlotSet* SlotSet = FindOrBuildInteractionSlots(Graspable, GraspDataIndex);
+	if (!SlotSet)
+	{
+		return false;
+	}
+
+	OutSlots.Reserve(SlotSet->Slots.Num());
+	for (const FGraspInteractionSlot& Slot : SlotSet->Slots)
+	{
+		if (Slot.bValid)
+		{
+			OutSlots.Add(Slot.Location);
+		}
+	}
+	return OutSlots.Num() > 0;
+}
+
+bool UGraspSubsystem::FindInteractionSlot(const UPrimitiveComponent* Graspable, int32 GraspDataIndex,
+	const AActor* Interactor, FVector& OutLocation, int32& OutSlotIndex)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::FindInteractionSlot);
+
+	OutLocation = FVector::ZeroVector;
+	OutSlotIndex = INDEX_NONE;
+
+	const FGraspInteractionSlotSet* SlotSet = IsValid(Interactor) ? FindOrBuildInteractionSlots(Graspable, GraspDataIndex) : nullptr;
+	if (!SlotSet)
+	{
+		return false;
+	}
+
+	const FVector InteractorLocation = Interactor->GetActorLocation();
+	double BestDistSquared = TNumericLimits<double>::Max();
+	for (int32 i = 0; i < SlotSet->Slots.Num(); i++)
+	{
+		const FGraspInteractionSlot& Slot = SlotSet->Slots[i];
+		const AActor* Occupant = Slot.Occupant.Get();
+		if (!Slot.bValid || (Occupant && Occupant != Interactor))
+		{
+			continue;
+		}
+
+		const double DistSquared = FVector::DistSquared(InteractorLocation, Slot.Location);
+		if (DistSquared < BestDistSquared)
+		{
+			BestDistSquared = DistSquared;
+			OutSlotIndex = i;
+			OutLocation = Slot.Location;
+		}
+	}
+	return OutSlotIndex != INDEX_NONE;
+}
+
+bool UGraspSubsystem::OccupyInteractionSlot(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, int32 SlotIndex,
+	const AActor* Occupant)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::OccupyInteractionSlot);
+
+	FGraspInteractionSlotSet* SlotSet = IsValid(Occupant) ? FindOrBuildInteractionSlots(Graspable, GraspDataIndex) : nullptr;
+	if (!SlotSet || !SlotSet->Slots.IsValidIndex(SlotIndex) || !SlotSet->Slots[SlotIndex].bValid)
+	{
+		return false;
+	}
+
+	const AActor* Current = SlotSet->Slots[SlotIndex].Occupant.Get();
+	if (Current && Current != Occupant)
+	{
+		return false;
+	}
+
+	for (FGraspInteractionSlot& Slot : SlotSet->Slots)
+	{
+		if (Slot.Occupant.Get() == Occupant)
+		{
+			Slot.Occupant.Reset();
+		}
+	}
+	SlotSet->Slots[SlotIndex].Occupant = Occupant;
+	return true;
+}
+
+void UGraspSubsystem::ReleaseInteractionSlot(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Occupant)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::ReleaseInteractionSlot);
+
+	TArray<FGraspInteractionSlotSet, TInlineAllocator<1>>* SlotSets = Graspable ? InteractionSlots.Find(Graspable) : nullptr;
+	if (!SlotSets || !SlotSets->IsValidIndex(GraspDataIndex))
+	{
+		return;
+	}
+
+	for (FGraspInteractionSlot& Slot : (*SlotSets)[GraspDataIndex].Slots)
+	{
+		if (Slot.Occupant.Get() == Occupant)
+		{
+			Slot.Occupant.Reset();
+		}
+	}
+}
+
+UGraspSubsystem::FGraspInteractionSlotSet* UGraspSubsystem::FindOrBuildInteractionSlots(const UPrimitiveComponent* Graspable,
+	int32 GraspDataIndex)
+{
+	if (!IsValid(Graspable) || !UGraspStatics::GetGraspData(Graspable, GraspDataIndex))
+	{
+		return nullptr;
+	}
+
+	TArray<FGraspInteractionSlotSet, TInlineAllocator<1>>& SlotSets = InteractionSlots.FindOrAdd(Graspable);
+	if (SlotSets.Num() <= GraspDataIndex)
+	{
+		SlotSets.SetNum(GraspDataIndex + 1);
+	}
+
+	// Rebuild if the graspable moved more than 1cm or rotated at all
+	FGraspInteractionSlotSet& SlotSet = SlotSets[GraspDataIndex];
+	const FTransform& Transform = Graspable->GetComponentTransform();
+	if (!SlotSet.bBuilt || !SlotSet.GraspableTransform.GetLocation().Equals(Transform.GetLocation(), 1.f) ||
+		!SlotSet.GraspableTransform.GetRotation().Equals(Transform.GetRotation(), KINDA_SMALL_NUMBER))
+	{
+		BuildInteractionSlots(Graspable, GraspDataIndex, SlotSet);
+	}
+	return &SlotSet;
+}
+
+void UGraspSubsystem::BuildInteractionSlots(const UPrimitiveComponent* Graspable, int32 GraspDataIndex,
+	FGraspInteractionSlotSet& SlotSet) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::BuildInteractionSlots);
+
+	const UGraspDeveloper* Settings = GetDefault<UGraspDeveloper>();
+	const UGraspData* GraspData = UGraspStatics::GetGraspData(Graspable, GraspDataIndex);
+
+	SlotSet.GraspableTransform = Graspable->GetComponentTransform();
+	SlotSet.bBuilt = true;
+
+	// Slots keep their index and occupant, any past the new slot count are dropped
+	const int32 NumSlots = GraspData ? FMath::Max(0, Settings->InteractionSlotCount) : 0;
+	SlotSet.Slots.SetNum(NumSlots);
+	if (NumSlots == 0)
+	{
+		return;
+	}
+
+	const FVector GraspableLocation = Graspable->GetComponentLocation();
+	const FVector Forward2D = Graspable->GetForwardVector().GetSafeNormal2D();
+	const float Distance = GraspData->MaxGraspDistance * Settings->InteractionSlotDistanceAlpha;
+
+	// A full circle is spread evenly without doubling up at the back, a cone is spread edge to edge
+	const bool bFullCircle = GraspData->MaxGraspAngle >= 360.f;
+	const float MaxAngle = bFullCircle ? 180.f : GraspData->MaxGraspAngle * 0.5f * Settings->InteractionSlotAngleAlpha;
+	const float AngleStep = bFullCircle ? 360.f / NumSlots : (NumSlots > 1 ? (2.f * MaxAngle) / (NumSlots - 1) : 0.f);
+	const float StartAngle = bFullCircle || NumSlots == 1 ? 0.f : -MaxAngle;
+
+	// Without navigation the slots are still useful, they just aren't projected
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const bool bProject = NavSys && NavSys->GetDefaultNavDataInstance() != nullptr;
+
+	for (int32 i = 0; i < NumSlots; i++)
+	{
+		FGraspInteractionSlot& Slot = SlotSet.Slots[i];
+		Slot.bValid = false;
+
+		const FVector Direction = Forward2D.RotateAngleAxis(StartAngle + AngleStep * i, FVector::UpVector);
+		FVector Location = GraspableLocation + Direction * Distance;
+
+		if (bProject)
+		{
+			FNavLocation NavLocation;
+			if (!NavSys->ProjectPointToNavigation(Location, NavLocation, Settings->InteractionSlotProjectionExtent))
+			{
+				Slot.Occupant.Reset();
+				continue;
+			}
+			Location = NavLocation.Location;
+
+			// Projection can pull the slot out of range
+			const float DistSquared = GraspData->bGraspDistance2D ?
+				FVector::DistSquared2D(Location, GraspableLocation) : FVector::DistSquared(Location, GraspableLocation);
+			if (DistSquared > FMath::Square(GraspData->MaxGraspDistance))
+			{
+				Slot.Occupant.Reset();
+				continue;
+			}
+		}
+
+		Slot.Location = Location;
+		Slot.bValid = true;
+	}
+}
+
+void UGraspSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	for (TPair<TObjectKey<UPrimitiveComponent>, TArray<FGraspInteractionSlotSet, TInlineAllocator<1>>>& SlotSets : InteractionSlots)
+	{
+		for (FGraspInteractionSlotSet& SlotSet : SlotSets.Value)
+		{
+			SlotSet.bBuilt = false;
+		}
+	}
+}
+
+bool UGraspSubsystem::ClaimGraspable(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Claimant)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::ClaimGraspable);
+
+	const UGraspData* GraspData = IsValid(Graspable) ? UGraspStatics::GetGraspData(Graspable, GraspDataIndex) : nullptr;
+	if (!GraspData || !IsValid(Claimant))
+	{
+		return false;
+	}
+
+	TArray<FGraspClaimants, TInlineAllocator<1>>& Claims = Reservations.FindOrAdd(Graspable);
+	if (Claims.Num() <= GraspDataIndex)
+	{
+		Claims.SetNum(GraspDataIndex + 1);
+	}
+
+	// Drop claimants that were destroyed without releasing
+	FGraspClaimants& Claimants = Claims[GraspDataIndex];
+	Claimants.RemoveAllSwap([](const TWeakObjectPtr<const AActor>& Existing) { return !Existing.IsValid(); });
+
+	if (Claimants.Contains(Claimant))
+	{
+		return true;
+	}
+
+	if (GraspData->MaxConcurrentInteractors > 0 && Claimants.Num() >= GraspData->MaxConcurrentInteractors)
+	{
+		return false;
+	}
+
+	Claimants.Add(Claimant);
+	return true;
+}
+
+void UGraspSubsystem::ReleaseGraspable(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Claimant)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::ReleaseGraspable);
+
+	TArray<FGraspClaimants, TInlineAllocator<1>>* Claims = Graspable ? Reservations.Find(Graspable) : nullptr;
+	if (!Claims || !Claims->IsValidIndex(GraspDataIndex))
+	{
+		return;
+	}
+
+	(*Claims)[GraspDataIndex].RemoveAllSwap([Claimant](const TWeakObjectPtr<const AActor>& Existing)
+	{
+		return !Existing.IsValid() || Existing.Get() == Claimant;
+	});
+}
+
+void UGraspSubsystem::ReleaseAllGraspableClaims(const AActor* Claimant)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGraspSubsystem::ReleaseAllGraspableClaims);
+
+	for (auto It = Reservations.CreateIterator(); It; ++It)
+	{
+		bool bAnyClaims = false;
+		for (FGraspClaimants& Claimants : It->Value)
+		{
+			Claimants.RemoveAllSwap([Claimant](const TWeakObjectPtr<const AActor>& Existing)
+			{
+				return !Existing.IsValid() || Existing.Get() == Claimant;
+			});
+			bAnyClaims |= Claimants.Num() > 0;
+		}
+
+		if (!bAnyClaims)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 UGraspSubsystem::GetNumGraspableClaims(const UPrimitiveComponent* Graspable, int32 GraspDataIndex) const
+{
+	const TArray<FGraspClaimants, TInlineAllocator<1>>* Claims = Graspable ? Reservations.Find(Graspable) : nullptr;
+	if (!Claims || !Claims->IsValidIndex(GraspDataIndex))
+	{
+		return 0;
+	}
+
+	int32 Num = 0;
+	for (const TWeakObjectPtr<const AActor>& Claimant : (*Claims)[GraspDataIndex])
+	{
+		Num += Claimant.IsValid() ? 1 : 0;
+	}
+	return Num;
+}
+
+bool UGraspSubsystem::IsGraspableFullyReserved(const UPrimitiveComponent* Graspable, int32 GraspDataIndex,
+	const AActor* IgnoreClaimant) const
+{
+	const UGraspData* GraspData = IsValid(Graspable) ? UGraspStatics::GetGraspData(Graspable, GraspDataIndex) : nullptr;
+	if (!GraspData || GraspData->MaxConcurrentInteractors <= 0)
+	{
+		return false;
+	}
+
+	const TArray<FGraspClaimants, TInlineAllocator<1>>* Claims = Reservations.Find(Graspable);
+	if (!Claims || !Claims->IsValidIndex(GraspDataIndex))
+	{
+		return false;
+	}
+
+	int32 Num = 0;
+	for (const TWeakObjectPtr<const AActor>& Claimant : (*Claims)[GraspDataIndex])
+	{
+		const AActor* Actor = Claimant.Get();
+		if (!Actor)
+		{
+			continue;
+		}
+
+		// Its own claim is still available to it
+		if (Actor == IgnoreClaimant)
+		{
+			return false;
+		}
+		Num++;
+	}
+	return Num >= GraspData->MaxConcurrentInteractors;
 }
@@ -8,4 +8,5 @@ namespace FGraspTags
 {
 	UE_DEFINE_GAMEPLAY_TAG(Grasp_Interact, "Grasp.Interact");
 	UE_DEFINE_GAMEPLAY_TAG(Grasp_Interact_Activate, "Grasp.Interact.Activate");
+	UE_DEFINE_GAMEPLAY_TAG(Grasp_Ability_Parked, "Grasp.Ability.Parked");
 }
\ No newline at end of file
@@ -2,7 +2,89 @@
 
 
 #include "GraspTypes.h"
+#include "GraspData.h"
+#include "Components/PrimitiveComponent.h"
+#include "UObject/CoreNet.h"
 
 DEFINE_LOG_CATEGORY(LogGrasp);
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspTypes)
+
+FGraspInteractParams FGraspInteractParams::Make(const UGraspData* GraspData, bool bApplyAuthNetTolerance)
+{
+	FGraspInteractParams Params;
+	if (!GraspData)
+	{
+		return Params;
+	}
+
+	const float AngleScalar = bApplyAuthNetTolerance ? GraspData->GetAuthNetToleranceAngleScalar() : 1.f;
+	const float DistanceScalar = bApplyAuthNetTolerance ? GraspData->GetAuthNetToleranceDistanceScalar() : 1.f;
+
+	Params.MaxGraspAngle = GraspData->MaxGraspAngle * AngleScalar;
+	Params.MaxGraspDistance = GraspData->MaxGraspDistance * DistanceScalar;
+	Params.MaxHighlightDistance = GraspData->MaxHighlightDistance * DistanceScalar;
+	Params.MaxHeightAbove = GraspData->MaxHeightAbove * DistanceScalar;
+	Params.MaxHeightBelow = GraspData->MaxHeightBelow * DistanceScalar;
+	Params.bGraspDistance2D = GraspData->bGraspDistance2D;
+	return Params;
+}
+
+namespace GraspMirror
+{
+	/** Corrections are only sent for graspables near the interactor, anything beyond this is malformed */
+	static constexpr int32 MaxCorrections = 1024;
+}
+
+void FGraspMirrorCorrections::Add(const UPrimitiveComponent* Graspable, bool bGranted)
+{
+	const int32 Index = Graspables.Add(Graspable);
+	if ((Index & 7) == 0)
+	{
+		GrantedBits.Add(0);
+	}
+	if (bGranted)
+	{
+		GrantedBits[Index >> 3] |= 1 << (Index & 7);
+	}
+}
+
+bool FGraspMirrorCorrections::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar << Sequence;
+	Ar << BaselineSequence;
+
+	uint32 NumGraspables = Graspables.Num();
+	Ar.SerializeIntPacked(NumGraspables);
+
+	if (Ar.IsLoading())
+	{
+		if (NumGraspables > GraspMirror::MaxCorrections)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+		Graspables.SetNum(NumGraspables);
+		GrantedBits.SetNumZeroed(FMath::DivideAndRoundUp<int32>(NumGraspables, 8));
+	}
+
+	for (TWeakObjectPtr<const UPrimitiveComponent>& Graspable : Graspables)
+	{
+		// Serialized as its net ID, graspables the client can't resolve arrive as null and are skipped
+		UObject* Object = const_cast<UPrimitiveComponent*>(Graspable.Get());
+		Map->SerializeObject(Ar, UPrimitiveComponent::StaticClass(), Object);
+		if (Ar.IsLoading())
+		{
+			Graspable = Cast<UPrimitiveComponent>(Object);
+		}
+	}
+
+	if (NumGraspables > 0)
+	{
+		Ar.SerializeBits(GrantedBits.GetData(), NumGraspables);
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
@@ -4,9 +4,11 @@
 #include "Targeting/GraspTargetSelection.h"
 
 #include "GraspDeveloper.h"
+#include "GraspSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "TargetingSystem/TargetingSubsystem.h"
 #include "Engine/OverlapResult.h"
+#include "Engine/HitResult.h"
 #include "Engine/World.h"
 #include "Components/PrimitiveComponent.h"
 #include "GameFramework/Character.h"
@@ -24,6 +26,7 @@ DEFINE_LOG_CATEGORY_STATIC(LogGraspTargeting, Log, All);
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspTargetSelection)
 
+DEFINE_TARGETING_DATA_STORE(FGraspTargetSelectionState)
 
 namespace FGraspCVars
 {
@@ -90,12 +93,52 @@ FVector UGraspTargetSelection::GetSourceOffset_Implementation(
 		bUseRelativeLocationOffset);
 }
 
+FVector UGraspTargetSelection::GetPredictionOffset(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::GetPredictionOffset);
+
+	if (PredictionTime <= 0.f || MaxPredictionDistance <= 0.f)
+	{
+		return FVector::ZeroVector;
+	}
+
+	const APawn* Pawn = GetPawnFromTargetingHandle(TargetingHandle);
+	if (!Pawn)
+	{
+		return FVector::ZeroVector;
+	}
+
+	FVector Velocity = Pawn->GetVelocity();
+	FVector Acceleration = FVector::ZeroVector;
+	if (const ACharacter* Character = Cast<ACharacter>(Pawn))
+	{
+		if (const UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+		{
+			Velocity = Movement->Velocity;
+			Acceleration = Movement->GetCurrentAcceleration();
+		}
+	}
+
+	// s = vt + 1/2at^2
+	FVector Offset = Velocity * PredictionTime + 0.5f * Acceleration * FMath::Square(PredictionTime);
+	if (bPredictAlongGround)
+	{
+		Offset.Z = 0.f;
+	}
+	return Offset.GetClampedToMaxSize(MaxPredictionDistance);
+}
+
+FVector UGraspTargetSelection::GetQueryLocation(const FTargetingRequestHandle& TargetingHandle) const
+{
+	return GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle) + GetPredictionOffset(TargetingHandle);
+}
+
 FQuat UGraspTargetSelection::GetSourceRotation_Implementation(
 	const FTargetingRequestHandle& TargetingHandle) const
 {
 	const bool bUseFallback = RotationSource == EGraspTargetRotationSource::Velocity || RotationSource==EGraspTargetRotationSource::Acceleration;
-	const TArray<EGraspTargetRotationSource> Fallbacks = bUseFallback ? FallbackRotationSources : TArray<EGraspTargetRotationSource>();
-	return UGraspTargetingStatics::GetSourceRotation(TargetingHandle, RotationSource, Fallbacks);
+	static const TArray<EGraspTargetRotationSource> NoFallbacks;
+	return UGraspTargetingStatics::GetSourceRotation(TargetingHandle, RotationSource, bUseFallback ? FallbackRotationSources : NoFallbacks);
 }
 
 FQuat UGraspTargetSelection::GetSourceRotationOffset_Implementation(
@@ -132,6 +175,7 @@ void UGraspTargetSelection::PostLoad()
 	Super::PostLoad();
 
 	UpdateGraspAbilityRadius();
+	ValidateCollisionSettings();
 }
 
 #if WITH_EDITOR
@@ -154,6 +198,8 @@ void UGraspTargetSelection::PostEditChangeProperty(struct FPropertyChangedEvent&
 			UpdateGraspAbilityRadius();
 		}
 	}
+
+	ValidateCollisionSettings();
 }
 #endif
 
@@ -260,6 +306,12 @@ void UGraspTargetSelection::Execute(const FTargetingRequestHandle& TargetingHand
 
 	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Executing);
 
+	// The graspable index needs no physics query, so completes immediately even for async requests
+	if (bUseGraspableIndex && CanUseGraspableIndex() && ExecuteIndexQuery(TargetingHandle))
+	{
+		return;
+	}
+
 	// @note: There isn't Async Overlap support based on Primitive Component, so even if using async targeting, it will
 	// run this task in "immediate" mode.
 	if (IsAsyncTargetingRequest(TargetingHandle))
@@ -272,6 +324,160 @@ void UGraspTargetSelection::Execute(const FTargetingRequestHandle& TargetingHand
 	}
 }
 
+bool UGraspTargetSelection::CanUseGraspableIndex() const
+{
+	// Object types take precedence over the profile and channel, which the index can't honor
+	if (CollisionObjectTypes.Num() == 0)
+	{
+		return false;
+	}
+
+	// The index holds graspables, which use the default grasp object type
+	const TEnumAsByte<EObjectTypeQuery> GraspObjectType = UCollisionProfile::Get()->ConvertToObjectType(
+		GetDefault<UGraspDeveloper>()->GraspDefaultObjectType);
+	for (const TEnumAsByte<EObjectTypeQuery>& ObjectType : CollisionObjectTypes)
+	{
+		if (ObjectType != GraspObjectType)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UGraspTargetSelection::ValidateCollisionSettings() const
+{
+	if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		return;
+	}
+
+	if (bUseGraspableIndex && !CanUseGraspableIndex())
+	{
+		UE_LOG(LogGraspTargeting, Warning, TEXT("%s: bUseGraspableIndex requires CollisionObjectTypes to contain only the GraspDefaultObjectType, a physics overlap will be used instead"),
+			*GetPathName());
+	}
+
+	if (bSweepFromLastLocation && CollisionObjectTypes.Num() == 0)
+	{
+		UE_LOG(LogGraspTargeting, Warning, TEXT("%s: bSweepFromLastLocation requires CollisionObjectTypes, an overlap in place will be used instead"),
+			*GetPathName());
+	}
+}
+
+bool UGraspTargetSelection::ExecuteIndexQuery(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::ExecuteIndexQuery);
+
+	const UWorld* World = GetSourceContextWorld(TargetingHandle);
+	const UGraspSubsystem* Subsystem = World ? World->GetSubsystem<UGraspSubsystem>() : nullptr;
+	if (!Subsystem || !TargetingHandle.IsValid())
+	{
+		return false;
+	}
+
+#if UE_ENABLE_DEBUG_DRAWING
+	ResetDebugString(TargetingHandle);
+#endif // UE_ENABLE_DEBUG_DRAWING
+
+	const FVector SourceLocation = GetQueryLocation(TargetingHandle);
+	const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
+	const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
+
+	FVector SweepStart;
+	const bool bSweep = GetSweepStart(TargetingHandle, SourceLocation, SweepStart);
+
+	// Broadphase: bound the shape, or both ends of the sweep, with a box
+	const float ShapeRadius = CollisionShape.IsBox() ? CollisionShape.GetExtent().Size() :
+		CollisionShape.IsCapsule() ? CollisionShape.GetCapsuleHalfHeight() : CollisionShape.GetSphereRadius();
+	FBox QueryBox = FBox::BuildAABB(SourceLocation, FVector(ShapeRadius));
+	if (bSweep)
+	{
+		QueryBox += FBox::BuildAABB(SweepStart, FVector(ShapeRadius));
+	}
+
+	TArray<UPrimitiveComponent*>& Candidates = IndexCandidatesScratch;
+	Candidates.Reset();
+	Subsystem->QueryGraspableIndex(QueryBox, Candidates);
+
+	// Ignore the same actors the physics query would
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	const AActor* IgnoredSource = SourceContext && bIgnoreSourceActor ? SourceContext->SourceActor : nullptr;
+	const AActor* IgnoredInstigator = SourceContext && bIgnoreInstigatorActor ? SourceContext->InstigatorActor : nullptr;
+
+	// Narrowphase: test each candidate's bounds against the shape, swept shapes are placed at the closest point
+	TArray<FOverlapResult>& OverlapResults = OverlapResultsScratch;
+	OverlapResults.Reset();
+	for (UPrimitiveComponent* Candidate : Candidates)
+	{
+		AActor* Owner = Candidate->GetOwner();
+		if (!Owner || Owner == IgnoredSource || Owner == IgnoredInstigator)
+		{
+			continue;
+		}
+
+		const FVector& Center = Candidate->Bounds.Origin;
+		const FVector ShapeLocation = bSweep ? FMath::ClosestPointOnSegment(Center, SweepStart, SourceLocation) : SourceLocation;
+		if (!DoesShapeOverlapSphere(CollisionShape, ShapeLocation, SourceRotation, Center, Candidate->Bounds.SphereRadius))
+		{
+			continue;
+		}
+
+		FOverlapResult& Overlap = OverlapResults.AddDefaulted_GetRef();
+		Overlap.OverlapObjectHandle = FActorInstanceHandle(Owner);
+		Overlap.Component = Candidate;
+		Overlap.ItemIndex = INDEX_NONE;
+		Overlap.bBlockingHit = false;
+	}
+	Candidates.Reset();
+
+	const int32 NumValidResults = ProcessOverlapResults(TargetingHandle, OverlapResults, bSweep ? &SweepStart : nullptr);
+	OverlapResults.Reset();
+
+#if UE_ENABLE_DEBUG_DRAWING
+	if (FGraspCVars::bGraspSelectionDebug)
+	{
+		const FColor& DebugColor = NumValidResults > 0 ? FColor::Red : FColor::Green;
+		DebugDrawBoundingVolume(TargetingHandle, DebugColor);
+	}
+#endif
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+	return true;
+}
+
+bool UGraspTargetSelection::DoesShapeOverlapSphere(const FCollisionShape& CollisionShape, const FVector& ShapeLocation,
+	const FQuat& ShapeRotation, const FVector& SphereCenter, float SphereRadius) const
+{
+	// Work in the shape's local space
+	const FVector Local = ShapeRotation.UnrotateVector(SphereCenter - ShapeLocation);
+
+	switch (ShapeType)
+	{
+	case EGraspTargetingShape::Box:
+		{
+			const FVector Extent = CollisionShape.GetExtent();
+			const FVector Closest = Local.BoundToBox(-Extent, Extent);
+			return FVector::DistSquared(Local, Closest) <= FMath::Square(SphereRadius);
+		}
+	case EGraspTargetingShape::Cylinder:
+		{
+			const FVector Extent = CollisionShape.GetExtent();
+			return FMath::Abs(Local.Z) <= Extent.Z + SphereRadius && Local.Size2D() <= Extent.X + SphereRadius;
+		}
+	case EGraspTargetingShape::Sphere:
+		return Local.SizeSquared() <= FMath::Square(CollisionShape.GetSphereRadius() + SphereRadius);
+	case EGraspTargetingShape::Capsule:
+	case EGraspTargetingShape::CharacterCapsule:
+		{
+			const float AxisHalfLength = CollisionShape.GetCapsuleAxisHalfLength();
+			const FVector Closest(0.f, 0.f, FMath::Clamp<double>(Local.Z, -AxisHalfLength, AxisHalfLength));
+			return FVector::DistSquared(Local, Closest) <= FMath::Square(CollisionShape.GetCapsuleRadius() + SphereRadius);
+		}
+	default: return false;
+	}
+}
+
 void UGraspTargetSelection::ExecuteImmediateTrace(const FTargetingRequestHandle& TargetingHandle) const
 {
 #if UE_ENABLE_DEBUG_DRAWING
@@ -283,23 +489,37 @@ void UGraspTargetSelection::ExecuteImmediateTrace(const FTargetingRequestHandle&
 	const UWorld* World = GetSourceContextWorld(TargetingHandle);
 	if (World && TargetingHandle.IsValid())
 	{
-		const FVector SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
+		const FVector SourceLocation = GetQueryLocation(TargetingHandle);
 		const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
 
-		TArray<FOverlapResult> OverlapResults;
+		// Reuse the scratch buffer's capacity, immediate traces only run on the game thread
+		TArray<FOverlapResult>& OverlapResults = OverlapResultsScratch;
+		OverlapResults.Reset();
+
 		const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
 		FCollisionQueryParams OverlapParams(TEXT("UGraspTargetSelection_AOE"), SCENE_QUERY_STAT_ONLY(UGraspTargetSelection_AOE), false);
 		InitCollisionParams(TargetingHandle, OverlapParams);
 
-		if (CollisionObjectTypes.Num() > 0)
+		FCollisionObjectQueryParams ObjectParams;
+		for (auto Iter = CollisionObjectTypes.CreateConstIterator(); Iter; ++Iter)
 		{
-			FCollisionObjectQueryParams ObjectParams;
-			for (auto Iter = CollisionObjectTypes.CreateConstIterator(); Iter; ++Iter)
-			{
-				const ECollisionChannel& Channel = UCollisionProfile::Get()->ConvertToCollisionChannel(false, *Iter);
-				ObjectParams.AddObjectTypesToQuery(Channel);
-			}
+			const ECollisionChannel& Channel = UCollisionProfile::Get()->ConvertToCollisionChannel(false, *Iter);
+			ObjectParams.AddObjectTypesToQuery(Channel);
+		}
 
+		FVector SweepStart;
+		const bool bSweep = GetSweepStart(TargetingHandle, SourceLocation, SweepStart);
+		if (bSweep)
+		{
+			// Only object type queries are swept, see GetSweepStart()
+			TArray<FHitResult>& SweepHits = SweepHitsScratch;
+			SweepHits.Reset();
+			World->SweepMultiByObjectType(SweepHits, SweepStart, SourceLocation, SourceRotation, ObjectParams, CollisionShape, OverlapParams);
+			ConvertSweepHits(SweepHits, OverlapResults);
+			SweepHits.Reset();
+		}
+		else if (CollisionObjectTypes.Num() > 0)
+		{
 			World->OverlapMultiByObjectType(OverlapResults, SourceLocation, SourceRotation, ObjectParams, CollisionShape, OverlapParams);
 		}
 		else if (CollisionProfileName.Name != TEXT("NoCollision"))
@@ -311,7 +531,8 @@ void UGraspTargetSelection::ExecuteImmediateTrace(const FTargetingRequestHandle&
 			World->OverlapMultiByChannel(OverlapResults, SourceLocation, SourceRotation, CollisionChannel, CollisionShape, OverlapParams);
 		}
 
-		const int32 NumValidResults = ProcessOverlapResults(TargetingHandle, OverlapResults);
+		const int32 NumValidResults = ProcessOverlapResults(TargetingHandle, OverlapResults, bSweep ? &SweepStart : nullptr);
+		OverlapResults.Reset();
 		
 #if UE_ENABLE_DEBUG_DRAWING
 		if (FGraspCVars::bGraspSelectionDebug)
@@ -332,23 +553,32 @@ void UGraspTargetSelection::ExecuteAsyncTrace(const FTargetingRequestHandle& Tar
 	UWorld* World = GetSourceContextWorld(TargetingHandle);
 	if (World && TargetingHandle.IsValid())
 	{
-		const FVector SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
+		const FVector SourceLocation = GetQueryLocation(TargetingHandle);
 		const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
 
 		const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
 		FCollisionQueryParams OverlapParams(TEXT("UGraspTargetSelection_AOE"), SCENE_QUERY_STAT_ONLY(UGraspTargetSelection_AOE_Shape), false);
 		InitCollisionParams(TargetingHandle, OverlapParams);
 
+		FCollisionObjectQueryParams ObjectParams;
+		for (auto Iter = CollisionObjectTypes.CreateConstIterator(); Iter; ++Iter)
+		{
+			const ECollisionChannel& Channel = UCollisionProfile::Get()->ConvertToCollisionChannel(false, *Iter);
+			ObjectParams.AddObjectTypesToQuery(Channel);
+		}
+
+		// Sweep from the last scan's location as a single async sweep
+		FVector SweepStart;
+		if (GetSweepStart(TargetingHandle, SourceLocation, SweepStart))
+		{
+			const FTraceDelegate Delegate = FTraceDelegate::CreateUObject(this, &UGraspTargetSelection::HandleAsyncSweepComplete, TargetingHandle);
+			World->AsyncSweepByObjectType(EAsyncTraceType::Multi, SweepStart, SourceLocation, SourceRotation, ObjectParams, CollisionShape, OverlapParams, &Delegate);
+			return;
+		}
+
 		const FOverlapDelegate Delegate = FOverlapDelegate::CreateUObject(this, &UGraspTargetSelection::HandleAsyncOverlapComplete, TargetingHandle);
 		if (CollisionObjectTypes.Num() > 0)
 		{
-			FCollisionObjectQueryParams ObjectParams;
-			for (auto Iter = CollisionObjectTypes.CreateConstIterator(); Iter; ++Iter)
-			{
-				const ECollisionChannel& Channel = UCollisionProfile::Get()->ConvertToCollisionChannel(false, *Iter);
-				ObjectParams.AddObjectTypesToQuery(Channel);
-			}
-
 			World->AsyncOverlapByObjectType(SourceLocation, SourceRotation, ObjectParams, CollisionShape, OverlapParams, &Delegate);
 		}
 		else if (CollisionProfileName.Name != TEXT("NoCollision"))
@@ -366,6 +596,84 @@ void UGraspTargetSelection::ExecuteAsyncTrace(const FTargetingRequestHandle& Tar
 	}
 }
 
+void UGraspTargetSelection::HandleAsyncSweepComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum,
+	FTargetingRequestHandle TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::HandleAsyncSweepComplete);
+
+	if (TargetingHandle.IsValid())
+	{
+#if UE_ENABLE_DEBUG_DRAWING
+		ResetDebugString(TargetingHandle);
+#endif
+
+		// Async callbacks are dispatched on the game thread
+		TArray<FOverlapResult>& OverlapResults = OverlapResultsScratch;
+		OverlapResults.Reset();
+		ConvertSweepHits(InTraceDatum.OutHits, OverlapResults);
+
+		const int32 NumValidResults = ProcessOverlapResults(TargetingHandle, OverlapResults, &InTraceDatum.Start);
+		OverlapResults.Reset();
+
+#if UE_ENABLE_DEBUG_DRAWING
+		if (FGraspCVars::bGraspSelectionDebug)
+		{
+			const FColor& DebugColor = NumValidResults > 0 ? FColor::Red : FColor::Green;
+			DebugDrawBoundingVolume(TargetingHandle, DebugColor);
+		}
+#endif
+	}
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+}
+
+bool UGraspTargetSelection::GetSweepStart(const FTargetingRequestHandle& TargetingHandle, const FVector& SourceLocation,
+	FVector& OutSweepStart) const
+{
+	// Sweeps by profile or channel stop at the first blocking hit, unlike the overlap they replace
+	if (!bSweepFromLastLocation || CollisionObjectTypes.Num() == 0)
+	{
+		return false;
+	}
+
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	if (!SourceContext || !SourceContext->SourceActor)
+	{
+		return false;
+	}
+
+	// First scan for this request, or its source changed
+	FGraspTargetSelectionState& State = FGraspTargetSelectionState::FindOrAdd(TargetingHandle);
+	const TObjectKey<AActor> SourceKey(SourceContext->SourceActor);
+	if (!State.bHasLastSourceLocation || State.Source != SourceKey)
+	{
+		State.Source = SourceKey;
+		State.LastSourceLocation = SourceLocation;
+		State.bHasLastSourceLocation = true;
+		return false;
+	}
+
+	OutSweepStart = State.LastSourceLocation;
+	State.LastSourceLocation = SourceLocation;
+
+	// Not moving, or teleported
+	const double DistSquared = FVector::DistSquared(OutSweepStart, SourceLocation);
+	return DistSquared > KINDA_SMALL_NUMBER && DistSquared <= FMath::Square<double>(MaxSweepDistance);
+}
+
+void UGraspTargetSelection::ConvertSweepHits(const TArray<FHitResult>& Hits, TArray<FOverlapResult>& OutOverlaps)
+{
+	OutOverlaps.Reserve(OutOverlaps.Num() + Hits.Num());
+	for (const FHitResult& Hit : Hits)
+	{
+		FOverlapResult& Overlap = OutOverlaps.AddDefaulted_GetRef();
+		Overlap.OverlapObjectHandle = Hit.HitObjectHandle;
+		Overlap.Component = Hit.Component;
+		Overlap.ItemIndex = Hit.Item;
+		Overlap.bBlockingHit = Hit.bBlockingHit;
+	}
+}
+
 void UGraspTargetSelection::HandleAsyncOverlapComplete(const FTraceHandle& InTraceHandle,
 	FOverlapDatum& InOverlapDatum, FTargetingRequestHandle TargetingHandle) const
 {
@@ -392,7 +700,7 @@ void UGraspTargetSelection::HandleAsyncOverlapComplete(const FTraceHandle& InTra
 }
 
 int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle& TargetingHandle,
-	const TArray<FOverlapResult>& Overlaps) const
+	const TArray<FOverlapResult>& Overlaps, const FVector* SweepStart) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::ProcessOverlapResults);
 
@@ -407,7 +715,7 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 	if (Overlaps.Num() > 0)
 	{
 		FTargetingDefaultResultsSet& TargetingResults = FTargetingDefaultResultsSet::FindOrAdd(TargetingHandle);
-		const FVector SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
+		const FVector SourceLocation = GetQueryLocation(TargetingHandle);
 		const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
 
 		for (const FOverlapResult& OverlapResult : Overlaps)
@@ -420,8 +728,13 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 			// cylinders use box overlaps, so a radius check is necessary to constrain it to the bounds of a cylinder
 			if (ShapeType == EGraspTargetingShape::Cylinder)
 			{
+				// When sweeping the cylinder covers every location between the sweep start and the source location
 				const float RadiusSquared = (HalfExtent.X * HalfExtent.X);
-				const float DistanceSquared = FVector::DistSquared2D(OverlapResult.GetActor()->GetActorLocation(), SourceLocation);
+				const UPrimitiveComponent* Component = OverlapResult.GetComponent();
+				const FVector Location = Component ? Component->GetComponentLocation() : OverlapResult.GetActor()->GetActorLocation();
+				const float DistanceSquared = SweepStart ?
+					FMath::PointDistToSegmentSquared(FVector(Location.X, Location.Y, 0.f), FVector(SweepStart->X, SweepStart->Y, 0.f), FVector(SourceLocation.X, SourceLocation.Y, 0.f)) :
+					FVector::DistSquared2D(Location, SourceLocation);
 				if (DistanceSquared > RadiusSquared)
 				{
 					continue;
@@ -451,7 +764,6 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 				ResultData->HitResult.ImpactPoint = OverlapResult.GetActor()->GetActorLocation();
 				ResultData->HitResult.Location = OverlapResult.GetActor()->GetActorLocation();
 				ResultData->HitResult.bBlockingHit = OverlapResult.bBlockingHit;
-				ResultData->HitResult.TraceStart = SourceLocation;
 				ResultData->HitResult.Item = OverlapResult.ItemIndex;
 
 				// Store the normal based on where we are looking based on source rotation
@@ -459,6 +771,12 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 
 				// We need the normalized distance, which we calculate from GraspAbilityRadius
 				ResultData->HitResult.Distance = GraspAbilityRadius;
+
+				// Distance is measured from TraceStart, so swept results use the closest point the shape passed by
+				const UPrimitiveComponent* Component = OverlapResult.GetComponent();
+				const FVector Location = Component ? Component->GetComponentLocation() : OverlapResult.GetActor()->GetActorLocation();
+				ResultData->HitResult.TraceStart = SweepStart ?
+					FMath::ClosestPointOnSegment(Location, *SweepStart, SourceLocation) : SourceLocation;
 			}
 		}
 
@@ -530,7 +848,7 @@ void UGraspTargetSelection::DebugDrawBoundingVolume(const FTargetingRequestHandl
 {
 #if UE_ENABLE_DEBUG_DRAWING
 	const UWorld* World = GetSourceContextWorld(TargetingHandle);
-	const FVector SourceLocation = OverlapDatum ? OverlapDatum->Pos : GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
+	const FVector SourceLocation = OverlapDatum ? OverlapDatum->Pos : GetQueryLocation(TargetingHandle);
 	const FQuat SourceRotation = OverlapDatum ? OverlapDatum->Rot : (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
 	const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
 
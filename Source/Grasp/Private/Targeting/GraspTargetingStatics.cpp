@@ -97,7 +97,7 @@ FVector UGraspTargetingStatics::GetSourceOffset(const FTargetingRequestHandle& T
 }
 
 FQuat UGraspTargetingStatics::GetSourceRotation(const FTargetingRequestHandle& TargetingHandle,
-	EGraspTargetRotationSource RotationSource, TArray<EGraspTargetRotationSource> FallbackRotationSources,
+	EGraspTargetRotationSource RotationSource, const TArray<EGraspTargetRotationSource>& FallbackRotationSources,
 	int32 FallbackIndex)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetingStatics::GetSourceRotation);
@@ -5,6 +5,10 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemLog.h"
+#include "GraspSubsystem.h"
+#include "Engine/NetSerialization.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/RootMotionSource.h"
 #include "Net/UnrealNetwork.h"
@@ -12,6 +16,114 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AbilityTask_GraspFaceTowards)
 
+namespace GraspFaceTowards
+{
+	static constexpr uint8 ParamFlag_Quantized = 1 << 0;
+	static constexpr uint8 ParamFlag_Face2D = 1 << 1;
+	static constexpr uint8 ParamFlag_EnableGravity = 1 << 2;
+	static constexpr uint8 ParamFlag_StopWhenAbilityEnds = 1 << 3;
+	static constexpr uint8 ParamFlag_Tickless = 1 << 4;
+	static constexpr uint8 ParamFlag_HasLocation = 1 << 5;
+	static constexpr uint8 ParamFlag_HasDirection = 1 << 6;
+	static constexpr uint8 ParamFlag_InfiniteDuration = 1 << 7;
+
+	/** Quantized durations of this many milliseconds or more are followed by the unquantized duration */
+	static constexpr uint16 DurationMs_Unquantized = MAX_uint16;
+}
+
+bool FGraspFaceTowardsParams::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace GraspFaceTowards;
+
+	uint8 Flags = 0;
+	if (Ar.IsSaving())
+	{
+		Flags |= FRootMotionSource_GraspFaceTowards::ShouldQuantizeNetSerialize() ? ParamFlag_Quantized : 0;
+		Flags |= bFace2D ? ParamFlag_Face2D : 0;
+		Flags |= bEnableGravity ? ParamFlag_EnableGravity : 0;
+		Flags |= bStopWhenAbilityEnds ? ParamFlag_StopWhenAbilityEnds : 0;
+		Flags |= bTickless ? ParamFlag_Tickless : 0;
+		Flags |= !WorldLocation.IsZero() ? ParamFlag_HasLocation : 0;
+		Flags |= !WorldDirection.IsZero() ? ParamFlag_HasDirection : 0;
+		Flags |= Duration < 0.f ? ParamFlag_InfiniteDuration : 0;
+	}
+	Ar << Flags;
+
+	const bool bQuantized = (Flags & ParamFlag_Quantized) != 0;
+	bFace2D = (Flags & ParamFlag_Face2D) != 0;
+	bEnableGravity = (Flags & ParamFlag_EnableGravity) != 0;
+	bStopWhenAbilityEnds = (Flags & ParamFlag_StopWhenAbilityEnds) != 0;
+	bTickless = (Flags & ParamFlag_Tickless) != 0;
+
+	bOutSuccess = true;
+
+	// Zero vectors are omitted, they select which target is used
+	if (Flags & ParamFlag_HasLocation)
+	{
+		if (bQuantized)
+		{
+			// Same range as FVector_NetQuantize10, covering large worlds
+			bOutSuccess &= SerializePackedVector<10, 27>(WorldLocation, Ar);
+		}
+		else
+		{
+			Ar << WorldLocation;
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		WorldLocation = FVector::ZeroVector;
+	}
+
+	if (Flags & ParamFlag_HasDirection)
+	{
+		if (bQuantized)
+		{
+			bOutSuccess &= FRootMotionSource_GraspFaceTowards::SerializeQuantizedDirection(Ar, WorldDirection, bFace2D);
+		}
+		else
+		{
+			Ar << WorldDirection;
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		WorldDirection = FVector::ZeroVector;
+	}
+
+	if (Flags & ParamFlag_InfiniteDuration)
+	{
+		if (Ar.IsLoading())
+		{
+			Duration = -1.f;
+		}
+	}
+	else if (bQuantized)
+	{
+		uint16 DurationMs = 0;
+		if (Ar.IsSaving())
+		{
+			DurationMs = (uint16)FMath::Clamp(FMath::RoundToInt(Duration * 1000.f), 0, (int32)DurationMs_Unquantized);
+		}
+		Ar << DurationMs;
+
+		// Durations too long for milliseconds are sent as they are
+		if (DurationMs == DurationMs_Unquantized)
+		{
+			Ar << Duration;
+		}
+		else if (Ar.IsLoading())
+		{
+			Duration = DurationMs * 0.001f;
+		}
+	}
+	else
+	{
+		Ar << Duration;
+	}
+
+	return !Ar.IsError();
+}
 
 UAbilityTask_GraspFaceTowards::UAbilityTask_GraspFaceTowards(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -23,12 +135,6 @@ UAbilityTask_GraspFaceTowards::UAbilityTask_GraspFaceTowards(const FObjectInitia
 
 	TargetActor = nullptr;
 	TargetComponent = nullptr;
-	WorldLocation = FVector::ZeroVector;
-	WorldDirection = FVector::ZeroVector;
-	Duration = 0.2f;
-	bFace2D = true;
-	bEnableGravity = false;
-	bStopWhenAbilityEnds = false;
 
 	MovementComponent = nullptr;
 	bIsFinished = false;
@@ -40,29 +146,26 @@ void UAbilityTask_GraspFaceTowards::GetLifetimeReplicatedProps(TArray<class FLif
 
 	DOREPLIFETIME(ThisClass, TargetActor);
 	DOREPLIFETIME(ThisClass, TargetComponent);
-	DOREPLIFETIME(ThisClass, WorldLocation);
-	DOREPLIFETIME(ThisClass, WorldDirection);
-	DOREPLIFETIME(ThisClass, bFace2D);
-	DOREPLIFETIME(ThisClass, Duration);
-	DOREPLIFETIME(ThisClass, bEnableGravity);
-	DOREPLIFETIME(ThisClass, bStopWhenAbilityEnds);
+	DOREPLIFETIME(ThisClass, Params);
 }
 
 UAbilityTask_GraspFaceTowards* UAbilityTask_GraspFaceTowards::FaceTowards(UGameplayAbility* OwningAbility,
 	const TObjectPtr<const USceneComponent>& TargetComponent, const TObjectPtr<const AActor>& TargetActor,
 	const FVector WorldDirection, const FVector WorldLocation, float Duration, bool bFace2D, bool bEnableGravity,
-	bool bStopWhenAbilityEnds)
+	bool bStopWhenAbilityEnds, bool bTickless)
 {
 	auto* MyTask = NewAbilityTask<UAbilityTask_GraspFaceTowards>(OwningAbility, StaticClass()->GetFName());
 
 	MyTask->TargetActor = TargetActor;
 	MyTask->TargetComponent = TargetComponent;
-	MyTask->WorldLocation = WorldLocation;
-	MyTask->WorldDirection = WorldDirection.GetSafeNormal();
-	MyTask->Duration = Duration;
-	MyTask->bFace2D = bFace2D;
-	MyTask->bEnableGravity = bEnableGravity;
-	MyTask->bStopWhenAbilityEnds = bStopWhenAbilityEnds;
+	MyTask->Params.WorldLocation = WorldLocation;
+	MyTask->Params.WorldDirection = WorldDirection.GetSafeNormal();
+	MyTask->Params.Duration = Duration;
+	MyTask->Params.bFace2D = bFace2D;
+	MyTask->Params.bEnableGravity = bEnableGravity;
+	MyTask->Params.bStopWhenAbilityEnds = bStopWhenAbilityEnds;
+	MyTask->Params.bTickless = bTickless;
+	MyTask->bTickingTask = !bTickless;
 	
 	// Bind to OnFinished then call SharedInitAndApply() after creating this task
 	// Otherwise the task will not run
@@ -73,10 +176,10 @@ UAbilityTask_GraspFaceTowards* UAbilityTask_GraspFaceTowards::FaceTowards(UGamep
 UAbilityTask_GraspFaceTowards* UAbilityTask_GraspFaceTowards::K2_FaceTowards(UGameplayAbility* OwningAbility,
 	const USceneComponent* TargetComponent, const AActor* TargetActor,
 	const FVector WorldDirection, const FVector WorldLocation, float Duration, bool bFace2D, bool bEnableGravity,
-	bool bStopWhenAbilityEnds)
+	bool bStopWhenAbilityEnds, bool bTickless)
 {
 	UAbilityTask_GraspFaceTowards* MyTask = FaceTowards(OwningAbility, TargetComponent, TargetActor, WorldDirection, WorldLocation, Duration,
-		bFace2D, bEnableGravity, bStopWhenAbilityEnds);
+		bFace2D, bEnableGravity, bStopWhenAbilityEnds, bTickless);
 
 	MyTask->SharedInitAndApply();
 	return MyTask;
@@ -84,6 +187,9 @@ UAbilityTask_GraspFaceTowards* UAbilityTask_GraspFaceTowards::K2_FaceTowards(UGa
 
 void UAbilityTask_GraspFaceTowards::InitSimulatedTask(UGameplayTasksComponent& InGameplayTasksComponent)
 {
+	// Simulated tasks never complete themselves, tickless ones have nothing to tick for
+	bTickingTask = !Params.bTickless;
+
 	Super::InitSimulatedTask(InGameplayTasksComponent);
 	SharedInitAndApply();
 }
@@ -100,10 +206,10 @@ void UAbilityTask_GraspFaceTowards::SharedInitAndApply()
 
 		if (MovementComponent)
 		{
-			const TSharedPtr<FRootMotionSource_GraspFaceTowards> FaceTowards = MakeShared<FRootMotionSource_GraspFaceTowards>();
+			const TSharedPtr<FRootMotionSource_GraspFaceTowards> FaceTowards = AcquireRootMotionSource();
 			FaceTowards->InstanceName = TEXT("FaceTowards");
 			FaceTowards->Priority = Priority;
-			FaceTowards->Duration = FMath::Max(0.001f, Duration);
+			FaceTowards->Duration = FMath::Max(0.001f, Params.Duration);
 			
 			const FVector AvatarLocation = AvatarActor->GetActorLocation();
 			FaceTowards->StartDirection = AvatarActor->GetActorForwardVector();
@@ -117,27 +223,38 @@ void UAbilityTask_GraspFaceTowards::SharedInitAndApply()
 			{
 				FaceTowards->TargetDirection = (TargetActor->GetActorLocation() - AvatarLocation);
 			}
-			else if (!WorldDirection.IsZero())
+			else if (!Params.WorldDirection.IsZero())
 			{
-				FaceTowards->TargetDirection = WorldDirection;
+				FaceTowards->TargetDirection = Params.WorldDirection;
 			}
 			else
 			{
-				FaceTowards->TargetDirection = (WorldLocation - AvatarLocation);
+				FaceTowards->TargetDirection = (Params.WorldLocation - AvatarLocation);
 			}
 
 			// Normalize the direction
-			FaceTowards->TargetDirection = bFace2D ? FaceTowards->TargetDirection.GetSafeNormal2D() :
+			FaceTowards->TargetDirection = Params.bFace2D ? FaceTowards->TargetDirection.GetSafeNormal2D() :
 				FaceTowards->TargetDirection.GetSafeNormal();
 
 			// Gravity
-			if (bEnableGravity)
+			if (Params.bEnableGravity)
 			{
 				FaceTowards->Settings.SetFlag(ERootMotionSourceSettingsFlags::IgnoreZAccumulate);
 			}
 
 			// Apply the source
 			RootMotionSourceID = MovementComponent->ApplyRootMotionSource(FaceTowards);
+
+			// Complete from a timer instead of checking the source every tick
+			const bool bIsInfiniteDuration = Params.Duration < 0.f;
+			if (Params.bTickless && !bIsInfiniteDuration && !bIsSimulating)
+			{
+				if (const UWorld* World = GetWorld())
+				{
+					World->GetTimerManager().SetTimer(TicklessTimer, this, &ThisClass::OnTicklessTimer,
+						FaceTowards->Duration, false);
+				}
+			}
 		}
 	}
 	else
@@ -163,21 +280,11 @@ void UAbilityTask_GraspFaceTowards::TickTask(float DeltaTime)
 	if (MyActor)
 	{
 		const bool bTimedOut = HasTimedOut();
-		const bool bIsInfiniteDuration = Duration < 0.f;
+		const bool bIsInfiniteDuration = Params.Duration < 0.f;
 
 		if (!bIsInfiniteDuration && bTimedOut)
 		{
-			// Task has finished
-			bIsFinished = true;
-			if (!bIsSimulating)
-			{
-				MyActor->ForceNetUpdate();
-				if (ShouldBroadcastAbilityTaskDelegates())
-				{
-					OnFinish.Broadcast();
-				}
-				EndTask();
-			}
+			FinishFaceTowards();
 		}
 	}
 	else
@@ -187,6 +294,63 @@ void UAbilityTask_GraspFaceTowards::TickTask(float DeltaTime)
 	}
 }
 
+void UAbilityTask_GraspFaceTowards::FinishFaceTowards()
+{
+	// Task has finished
+	bIsFinished = true;
+	if (!bIsSimulating)
+	{
+		if (AActor* MyActor = GetAvatarActor())
+		{
+			MyActor->ForceNetUpdate();
+		}
+		if (ShouldBroadcastAbilityTaskDelegates())
+		{
+			OnFinish.Broadcast();
+		}
+		EndTask();
+	}
+}
+
+void UAbilityTask_GraspFaceTowards::OnTicklessTimer()
+{
+	if (bIsFinished)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UAbilityTask_GraspFaceTowards::OnTicklessTimer);
+
+	if (!GetAvatarActor())
+	{
+		bIsFinished = true;
+		EndTask();
+		return;
+	}
+
+	if (HasTimedOut())
+	{
+		FinishFaceTowards();
+		return;
+	}
+
+	// Movement hasn't simulated the final frame of the source yet
+	if (const UWorld* World = GetWorld())
+	{
+		TicklessTimer = World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::OnTicklessTimer);
+	}
+}
+
+TSharedPtr<FRootMotionSource_GraspFaceTowards> UAbilityTask_GraspFaceTowards::AcquireRootMotionSource() const
+{
+	// The pool lives on the world, so it is released with it
+	if (UGraspSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UGraspSubsystem>() : nullptr)
+	{
+		return Subsystem->AcquireFaceTowardsRootMotionSource();
+	}
+	return MakeShared<FRootMotionSource_GraspFaceTowards>();
+}
+
 bool UAbilityTask_GraspFaceTowards::HasTimedOut() const
 {
 	const TSharedPtr<FRootMotionSource> RMS = MovementComponent ?
@@ -208,6 +372,11 @@ void UAbilityTask_GraspFaceTowards::PreDestroyFromReplication()
 
 void UAbilityTask_GraspFaceTowards::OnDestroy(bool bInOwnerFinished)
 {
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TicklessTimer);
+	}
+
 	if (MovementComponent)
 	{
 		if (!bIsFinished && ShouldBroadcastAbilityTaskDelegates())
@@ -3,14 +3,35 @@
 
 #include "Tasks/RootMotionSource_GraspFaceTowards.h"
 
+#include "Engine/NetSerialization.h"
 #include "GameFramework/Character.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RootMotionSource_GraspFaceTowards)
 
+namespace FGraspCVars
+{
+	static bool bFaceTowardsQuantizeNetSerialize = true;
+	FAutoConsoleVariableRef CVarFaceTowardsQuantizeNetSerialize(
+		TEXT("p.Grasp.FaceTowards.QuantizeNetSerialize"),
+		bFaceTowardsQuantizeNetSerialize,
+		TEXT("If true, face towards root motion sources and tasks replicate quantized directions and durations.\n")
+		TEXT("2D directions are sent as a 16-bit yaw. The receiver reads the format from a flags byte"),
+		ECVF_Default);
+}
+
+namespace GraspFaceTowards
+{
+	static constexpr uint8 NetFlag_Quantized = 1 << 0;
+	static constexpr uint8 NetFlag_Is2D = 1 << 1;
+}
+
 
 FRootMotionSource_GraspFaceTowards::FRootMotionSource_GraspFaceTowards()
 	: StartDirection(FVector::ZeroVector)
 	, TargetDirection(FVector::ZeroVector)
+	, StartQuat(FQuat::Identity)
+	, TargetQuat(FQuat::Identity)
+	, bQuatsCached(false)
 {
 	// Disable Partial End Tick
 	// Otherwise we end up with very inconsistent velocities on the last frame.
@@ -18,6 +39,13 @@ FRootMotionSource_GraspFaceTowards::FRootMotionSource_GraspFaceTowards()
 	Settings.SetFlag(ERootMotionSourceSettingsFlags::DisablePartialEndTick);
 }
 
+void FRootMotionSource_GraspFaceTowards::CacheQuats()
+{
+	StartQuat = StartDirection.ToOrientationQuat();
+	TargetQuat = TargetDirection.ToOrientationQuat();
+	bQuatsCached = true;
+}
+
 FRootMotionSource* FRootMotionSource_GraspFaceTowards::Clone() const
 {
 	FRootMotionSource_GraspFaceTowards* CopyPtr = new FRootMotionSource_GraspFaceTowards(*this);
@@ -51,8 +79,10 @@ void FRootMotionSource_GraspFaceTowards::PrepareRootMotion(float SimulationTime,
 	{
 		const float MoveFraction = FMath::Clamp(GetTime() / Duration, 0.f, 1.f);
 
-		const FQuat StartQuat = StartDirection.ToOrientationQuat();
-		const FQuat TargetQuat = TargetDirection.ToOrientationQuat();
+		if (!bQuatsCached)
+		{
+			CacheQuats();
+		}
 
 		FQuat CurrentQuat = FQuat::Slerp(StartQuat, TargetQuat, MoveFraction);
 
@@ -94,10 +124,63 @@ bool FRootMotionSource_GraspFaceTowards::NetSerialize(FArchive& Ar, UPackageMap*
 		return false;
 	}
 
-	Ar << StartDirection;
-	Ar << TargetDirection;
+	using namespace GraspFaceTowards;
 
-	bOutSuccess = true;
+	// Flags byte describes the format, so the receiver doesn't need to match the sender's settings
+	uint8 Flags = 0;
+	if (Ar.IsSaving() && ShouldQuantizeNetSerialize())
+	{
+		Flags |= NetFlag_Quantized;
+		if (FMath::IsNearlyZero(StartDirection.Z) && FMath::IsNearlyZero(TargetDirection.Z))
+		{
+			Flags |= NetFlag_Is2D;
+		}
+	}
+	Ar << Flags;
+
+	if (Flags & NetFlag_Quantized)
+	{
+		const bool b2D = (Flags & NetFlag_Is2D) != 0;
+		bOutSuccess = SerializeQuantizedDirection(Ar, StartDirection, b2D);
+		bOutSuccess &= SerializeQuantizedDirection(Ar, TargetDirection, b2D);
+	}
+	else
+	{
+		Ar << StartDirection;
+		Ar << TargetDirection;
+		bOutSuccess = true;
+	}
+
+	if (Ar.IsLoading())
+	{
+		InvalidateCachedQuats();
+	}
+
+	return !Ar.IsError();
+}
+
+bool FRootMotionSource_GraspFaceTowards::ShouldQuantizeNetSerialize()
+{
+	return FGraspCVars::bFaceTowardsQuantizeNetSerialize;
+}
+
+bool FRootMotionSource_GraspFaceTowards::SerializeQuantizedDirection(FArchive& Ar, FVector& Direction, bool b2D)
+{
+	if (!b2D)
+	{
+		return SerializeFixedVector<1, 16>(Direction, Ar);
+	}
+
+	uint16 Yaw = 0;
+	if (Ar.IsSaving())
+	{
+		Yaw = FRotator::CompressAxisToShort(Direction.Rotation().Yaw);
+	}
+	Ar << Yaw;
+	if (Ar.IsLoading())
+	{
+		Direction = FRotator(0.f, FRotator::DecompressAxisFromShort(Yaw), 0.f).Vector();
+	}
 	return true;
 }
 
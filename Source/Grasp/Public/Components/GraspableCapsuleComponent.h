@@ -7,6 +7,7 @@
 #include "GraspDeveloper.h"
 #include "Components/CapsuleComponent.h"
 #include "GraspStatics.h"
+#include "GraspSubsystem.h"
 #include "GraspableCapsuleComponent.generated.h"
 
 class UGraspData;
@@ -41,6 +42,8 @@ public:
 	}
 	/* ~IGraspable */
 
+	GRASP_REGISTER_GRASPABLE_COMPONENT()
+
 #if WITH_EDITORONLY_DATA
 	virtual void PostLoad() override
 	{
@@ -7,6 +7,7 @@
 #include "GraspDeveloper.h"
 #include "Components/SphereComponent.h"
 #include "GraspStatics.h"
+#include "GraspSubsystem.h"
 #include "GraspableSphereComponent.generated.h"
 
 class UGraspData;
@@ -41,6 +42,8 @@ public:
 	}
 	/* ~IGraspable */
 
+	GRASP_REGISTER_GRASPABLE_COMPONENT()
+
 #if WITH_EDITORONLY_DATA
 	virtual void PostLoad() override
 	{
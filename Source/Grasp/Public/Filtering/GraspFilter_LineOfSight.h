@@ -0,0 +1,103 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Tasks/TargetingTask.h"
+#include "Types/TargetingSystemTypes.h"
+#include "GraspFilter_LineOfSight.generated.h"
+
+struct FTraceHandle;
+struct FTraceDatum;
+
+/**
+ * Filter targets that are occluded from the source actor
+ * Async targeting requests trace every target as one batch of async line traces, and complete when all of them return
+ * Visibility is cached per source actor and target for a short time, so stationary sources don't re-trace every scan
+ */
+UCLASS(Blueprintable, DisplayName="Grasp Filter (Line Of Sight)")
+class GRASP_API UGraspFilter_LineOfSight : public UTargetingTask
+{
+	GENERATED_BODY()
+
+public:
+	/** The collision channel to trace against */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/** Whether to trace against complex collision */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter")
+	bool bTraceComplex = false;
+
+	/** Offset applied to the trace start, relative to the source actor's rotation. Pawns trace from their view location */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter")
+	FVector SourceOffset = FVector::ZeroVector;
+
+	/** How long a visibility result is reused for, 0 to always trace */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter", meta=(ClampMin="0", UIMin="0", ForceUnits="s"))
+	float VisibilityCacheDuration = 0.2f;
+
+	/** Cached visibility is discarded if the source has moved further than this since it was traced */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter", meta=(ClampMin="0", UIMin="0", ForceUnits="cm"))
+	float VisibilityCacheTolerance = 10.f;
+
+protected:
+	/** Cached visibility of a target from a source actor */
+	struct FGraspVisibilityCacheEntry
+	{
+		FVector SourceLocation = FVector::ZeroVector;
+		double Time = 0.0;
+		bool bVisible = false;
+	};
+
+	using FGraspVisibilityCacheKey = TPair<TObjectKey<AActor>, TObjectKey<UPrimitiveComponent>>;
+
+	/** Async traces still outstanding for a targeting request */
+	struct FGraspLineOfSightPending
+	{
+		int32 NumOutstanding = 0;
+		double StartTime = 0.0;
+
+		/** Identifies the execution that issued the traces, so late traces from an earlier execution are ignored */
+		uint32 Serial = 0;
+
+		TArray<TObjectKey<UPrimitiveComponent>> Occluded;
+	};
+
+	mutable TMap<FGraspVisibilityCacheKey, FGraspVisibilityCacheEntry> VisibilityCache;
+	mutable TMap<FTargetingRequestHandle, FGraspLineOfSightPending> PendingRequests;
+	mutable double LastPruneTime = 0.0;
+	mutable uint32 LastPendingSerial = 0;
+
+public:
+	UGraspFilter_LineOfSight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** Evaluation function called by derived classes to process the targeting request */
+	virtual void Execute(const FTargetingRequestHandle& TargetingHandle) const override;
+
+protected:
+	/** @return Location to trace from for the source actor */
+	FVector GetTraceStart(const AActor* SourceActor) const;
+
+	/** @return True if the trace reached the target without being blocked by anything else */
+	static bool IsTargetVisible(const UPrimitiveComponent* Target, const FHitResult* BlockingHit);
+
+	/** @return Cached visibility for the target if it is still valid */
+	const FGraspVisibilityCacheEntry* FindCachedVisibility(const FGraspVisibilityCacheKey& Key, const FVector& SourceLocation,
+		double TimeSeconds) const;
+
+	/** Remove expired cache entries, at most once per cache duration */
+	void PruneVisibilityCache(double TimeSeconds) const;
+
+	/** Remove pending traces for requests that were released, or ended before their traces returned */
+	void PrunePendingRequests(double TimeSeconds) const;
+
+	/** Callback for each async line trace */
+	void HandleAsyncTraceComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum,
+		FTargetingRequestHandle TargetingHandle, uint32 Serial, FGraspVisibilityCacheKey Key, FVector SourceLocation) const;
+
+	/** Remove occluded targets from the results */
+	static void RemoveOccludedTargets(const FTargetingRequestHandle& TargetingHandle,
+		const TArray<TObjectKey<UPrimitiveComponent>>& Occluded);
+};
@@ -7,6 +7,8 @@
 #include "Abilities/GameplayAbility.h"
 #include "GraspAbilityData.generated.h"
 
+class UGraspData;
+
 /**
  * Granted ability data
  */
@@ -17,6 +19,7 @@ struct GRASP_API FGraspAbilityData
 
 	FGraspAbilityData()
 		: bPersistent(false)
+		, bParked(false)
 		, Handle(FGameplayAbilitySpecHandle())
 		, Ability(nullptr)
 	{}
@@ -24,6 +27,10 @@ struct GRASP_API FGraspAbilityData
 	UPROPERTY(BlueprintReadOnly, Category=Grasp)
 	bool bPersistent;
 
+	/** Ability is out of range but kept granted for reuse, see UGraspComponent::MaxParkedGraspAbilities */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	bool bParked;
+
 	UPROPERTY(BlueprintReadOnly, Category=Grasp)
 	FGameplayAbilitySpecHandle Handle;
 
@@ -33,11 +40,55 @@ struct GRASP_API FGraspAbilityData
 	UPROPERTY(BlueprintReadOnly, Category=Grasp)
 	TSubclassOf<UGameplayAbility> Ability;
 
-	/** Interactables that have an ability lock, preventing the ability from being cleared */
-	UPROPERTY()
-	TArray<TWeakObjectPtr<const UPrimitiveComponent>> LockedGraspables;
+	/**
+	 * Interactables that have an ability lock, preventing the ability from being cleared, with their lock count
+	 * Destroyed interactables are removed when they unregister from UGraspSubsystem, or after garbage collection
+	 */
+	TMap<TObjectKey<UPrimitiveComponent>, int32> LockedGraspables;
 
 	/** Interactables that are in range and require this ability remain active */
 	UPROPERTY()
 	TArray<TWeakObjectPtr<const UPrimitiveComponent>> Graspables;
+};
+
+/**
+ * An ability given or cleared by a scan, see UGraspComponent::bBatchAbilityNotifications
+ */
+USTRUCT(BlueprintType)
+struct GRASP_API FGraspAbilityChange
+{
+	GENERATED_BODY()
+
+	FGraspAbilityChange()
+		: Ability(nullptr)
+		, GraspData(nullptr)
+		, bGiven(false)
+	{}
+
+	FGraspAbilityChange(const TSubclassOf<UGameplayAbility>& InAbility, const UPrimitiveComponent* InGraspable,
+		const UGraspData* InGraspData, const FGameplayAbilitySpecHandle& InHandle, bool bInGiven)
+		: Ability(InAbility)
+		, Graspable(const_cast<UPrimitiveComponent*>(InGraspable))
+		, GraspData(const_cast<UGraspData*>(InGraspData))
+		, Handle(InHandle)
+		, bGiven(bInGiven)
+	{}
+
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	TSubclassOf<UGameplayAbility> Ability;
+
+	/** The graspable that caused the change */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	TWeakObjectPtr<UPrimitiveComponent> Graspable;
+
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	TObjectPtr<UGraspData> GraspData;
+
+	/** Handle of the spec, cleared abilities are already removed or parked by the time this is received */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	FGameplayAbilitySpecHandle Handle;
+
+	/** True if the ability was given, false if it was cleared */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	bool bGiven;
 };
\ No newline at end of file
@@ -19,6 +19,8 @@ struct FGameplayAbilitySpecHandle;
 class UGraspData;
 class UGameplayAbility;
 class UAbilitySystemComponent;
+class UTargetingPreset;
+class UTargetingSubsystem;
 class AController;
 
 /**
@@ -39,6 +41,15 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp)
 	TArray<TSubclassOf<UGameplayAbility>> CommonGraspAbilities;
 
+	/**
+	 * Number of grasp abilities to keep granted after they go out of range, instead of clearing them
+	 * Parked abilities keep their spec and instance, so walking back into range doesn't create them again
+	 * They can't be activated while parked, and the least recently parked ability is cleared when this is exceeded
+	 * A middle ground between CommonGraspAbilities and clearing every time, 0 to always clear
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, meta=(ClampMin="0", UIMin="0", UIMax="16"))
+	int32 MaxParkedGraspAbilities = 0;
+
 	/** Targeting presets for finding graspables to interact with, used unless overriding GetTargetingPresets() */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp)
 	TMap<FGameplayTag, TObjectPtr<UTargetingPreset>> DefaultTargetingPresets = { { FGraspTags::Grasp_Interact, nullptr } };
@@ -62,6 +73,50 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
 	bool bEndTargetingRequestsOnPawnChange = false;
 
+	/**
+	 * If true, abilities given and cleared by a scan are notified in one batch once the scan is processed
+	 * PostGiveGraspAbility() and PreClearGraspAbility() are not called for scan changes, use GraspAbilitiesChanged() instead
+	 * Listeners get one call per scan instead of one per ability
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	bool bBatchAbilityNotifications = false;
+
+	/**
+	 * If true, the owning client runs its own scan at LocalScanInterval to drive UI and highlighting
+	 * Results are available from GetLocalScanResults() and OnLocalScanUpdated, they never grant abilities
+	 * Starts when InitializeGrasp() is called on the local controller, or via StartLocalScan()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	bool bEnableLocalScan = false;
+
+	/** How often the local scan runs, a scan is skipped if the previous one has not completed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, meta=(EditCondition="bEnableLocalScan", ClampMin="0.01", UIMin="0.01", ForceUnits="s"))
+	float LocalScanInterval = 0.1f;
+
+	/**
+	 * Targeting presets used by the local scan, if empty GetTargetingPresets() is used
+	 * Presets that filter on granted abilities (e.g. GraspFilter_CanActivateAbility) will not find anything on clients
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp, meta=(EditCondition="bEnableLocalScan"))
+	TMap<FGameplayTag, TObjectPtr<UTargetingPreset>> LocalScanTargetingPresets;
+
+	/**
+	 * If true, the local scan predicts which graspables have their ability granted using the server's grant logic
+	 * The server sends the owning client what changed since the granted graspables it last acknowledged, so prompts don't
+	 * wait for ability specs to replicate
+	 * Enables replication for this component, graspables must be net addressable (replicated or placed in the level)
+	 * @see FGraspLocalScanResult::bAbilityGranted, IsGraspableAbilityGranted()
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp, meta=(EditCondition="bEnableLocalScan"))
+	bool bEnableClientMirror = false;
+
+	/**
+	 * How long a predicted grant is trusted before the server must have granted it too
+	 * Should cover the server's scan rate plus latency, predictions the server never confirms revert after this
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp, meta=(EditCondition="bEnableClientMirror", ClampMin="0", UIMin="0", ForceUnits="s"))
+	float MirrorPredictionTimeout = 0.5f;
+
 public:
 	/** Track any change in preset update mode so we can rebind delegates as required */
 	UPROPERTY(Transient)
@@ -79,6 +134,76 @@ public:
 	UPROPERTY(Transient)
 	TMap<FGameplayTag, FTargetingRequestHandle> TargetingRequests;
 
+protected:
+	/** Targeting request handle kept between scans for reuse */
+	struct FGraspPooledTargetingRequest
+	{
+		FTargetingRequestHandle Handle;
+		TWeakObjectPtr<const UTargetingPreset> Preset;
+	};
+
+	/** Targeting presets used by the local scan, cached when it starts */
+	UPROPERTY(Transient, DuplicateTransient)
+	TMap<FGameplayTag, TObjectPtr<UTargetingPreset>> CurrentLocalScanPresets;
+
+	/** Local scan targeting request handles that are in-progress */
+	TMap<FGameplayTag, FTargetingRequestHandle> LocalTargetingRequests;
+
+	/** Abilities given and cleared by the scan being processed, see bBatchAbilityNotifications */
+	TArray<FGraspAbilityChange> PendingAbilityChanges;
+
+	/** Sorted results of the last completed local scan */
+	UPROPERTY(Transient)
+	TArray<FGraspLocalScanResult> LocalScanResults;
+
+	/** Results gathered by the in-progress local scan, swapped into LocalScanResults once every preset completes */
+	TArray<FGraspLocalScanResult> PendingLocalScanResults;
+
+	FTimerHandle LocalScanTimer;
+
+	/**
+	 * Targeting request handles mapped by preset tag, reused by each scan instead of making a new handle
+	 * Their result sets are reset in place, so they keep their capacity between scans
+	 */
+	TMap<FGameplayTag, FGraspPooledTargetingRequest> PooledTargetingRequests;
+
+	/** Targeting request handles reused by the local scan, kept apart as it can run alongside the scan on a listen server */
+	TMap<FGameplayTag, FGraspPooledTargetingRequest> PooledLocalTargetingRequests;
+
+	/** Graspables granted by the last scan on authority */
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> MirrorGranted;
+
+	/** Graspables granted by the in-progress scan on authority, swapped with MirrorGranted */
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> PendingMirrorGranted;
+
+	/** Graspables the client mirror predicts are granted, from the last completed local scan, with the time first predicted */
+	TMap<TObjectKey<UPrimitiveComponent>, float> MirrorPredictedGranted;
+
+	/** Graspables predicted by the in-progress local scan, swapped with MirrorPredictedGranted */
+	TMap<TObjectKey<UPrimitiveComponent>, float> PendingMirrorPredictedGranted;
+
+	/** The server's granted graspables at a mirror sequence */
+	struct FGraspMirrorState
+	{
+		uint16 Sequence = 0;
+		TArray<TWeakObjectPtr<const UPrimitiveComponent>> Granted;
+	};
+
+	/**
+	 * Recent mirror states, oldest first
+	 * On authority these are the states sent to the owning client, an acknowledged one becomes MirrorBaseline
+	 * On the owning client these are the states it received, the last is the server's current granted set
+	 */
+	TArray<FGraspMirrorState> MirrorHistory;
+
+	/** The last state the owning client acknowledged, corrections are sent as the difference from it */
+	FGraspMirrorState MirrorBaseline;
+
+	/** Sequence of the server's current granted set, 0 is the empty set before anything was granted */
+	uint16 MirrorSequence = 0;
+
+public:
+
 	/** Handle for the GraspScanAbility */
 	FGameplayAbilitySpecHandle ScanAbilityHandle;
 	
@@ -106,13 +231,26 @@ protected:
 	UPROPERTY()
 	TArray<FGraspScanResult> CurrentScanResults;
 
+	/** Results of the previous Grasp Focusing update, swapped with CurrentScanResults so neither reallocates */
+	TArray<FGraspScanResult> LastScanResults;
+
 	/** Data for granted abilities, mapped to the ability class */
 	UPROPERTY()
 	TMap<TSubclassOf<UGameplayAbility>, FGraspAbilityData> AbilityData;
 
+	/** Parked abilities, least recently parked first */
+	UPROPERTY(Transient)
+	TArray<TSubclassOf<UGameplayAbility>> ParkedGraspAbilities;
+
 	/** The ASC we were initialized with */
 	TWeakObjectPtr<UAbilitySystemComponent> ASC;
 
+	/** Binding to UGraspSubsystem::OnGraspableUnregistered, releases ability locks held by destroyed graspables */
+	FDelegateHandle GraspableUnregisteredHandle;
+
+	/** Binding to FCoreUObjectDelegates::GetPostGarbageCollect, releases locks held by graspables that never unregistered */
+	FDelegateHandle PostGarbageCollectHandle;
+
 public:
 	UAbilitySystemComponent* GetASC() { return ASC.IsValid() ? ASC.Get() : nullptr; }
 	const UAbilitySystemComponent* GetASC() const { return ASC.IsValid() ? ASC.Get() : nullptr; }
@@ -130,6 +268,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category=Grasp)
 	FOnPreClearGraspAbility OnPreClearGraspAbility;
 
+	/** Extension point called once per scan with the abilities it gave and cleared, see bBatchAbilityNotifications */
+	UPROPERTY(BlueprintAssignable, Category=Grasp)
+	FOnGraspAbilitiesChanged OnGraspAbilitiesChanged;
+
 	/** Extension point called before trying to activate the grasp ability */
 	UPROPERTY(BlueprintAssignable, Category=Grasp)
 	FOnPreTryActivateGraspAbility OnPreTryActivateGraspAbility;
@@ -141,6 +283,10 @@ public:
 	/** Extension point called after failing to activate the grasp ability */
 	UPROPERTY(BlueprintAssignable, Category=Grasp)
 	FOnPostFailedActivateGraspAbility OnPostFailedActivateGraspAbility;
+
+	/** Called on the owning client each time the local scan completes, see bEnableLocalScan */
+	UPROPERTY(BlueprintAssignable, Category=Grasp)
+	FOnGraspLocalScanUpdated OnLocalScanUpdated;
 	
 public:
 	UGraspComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
@@ -173,6 +319,31 @@ public:
 
 	/** Find the ability data mapped to the ability class */
 	const FGraspAbilityData* GetGraspAbilityData(const TSubclassOf<UGameplayAbility>& Ability) const;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Get a targeting request handle for the preset, ready to start
+	 * Reuses the handle from the last scan with this preset if possible, resetting its results in place
+	 */
+	FTargetingRequestHandle AcquireTargetingRequest(UTargetingSubsystem* TargetSubsystem, const FGameplayTag& PresetTag,
+		const UTargetingPreset* Preset, AActor* TargetingSource);
+
+	/**
+	 * Release pooled targeting request handles that are not in-progress
+	 * @param PresetTag The tag of the preset to release handles for, or all if tag is none
+	 */
+	void ReleasePooledTargetingRequests(const FGameplayTag& PresetTag);
+
+protected:
+	/** AcquireTargetingRequest() for a specific pool, the scan and local scan each have their own */
+	static FTargetingRequestHandle AcquirePooledTargetingRequest(TMap<FGameplayTag, FGraspPooledTargetingRequest>& Pool,
+		const TMap<FGameplayTag, FTargetingRequestHandle>& InProgressRequests, UTargetingSubsystem* TargetSubsystem,
+		const FGameplayTag& PresetTag, const UTargetingPreset* Preset, AActor* TargetingSource);
+
+	/** ReleasePooledTargetingRequests() for a specific pool */
+	static void ReleasePooledTargetingRequests(TMap<FGameplayTag, FGraspPooledTargetingRequest>& Pool,
+		const TMap<FGameplayTag, FTargetingRequestHandle>& InProgressRequests, const FGameplayTag& PresetTag);
 	
 public:
 	/** Rebind the OnPossessedPawnChanged binding if the requirement changes */
@@ -220,6 +391,15 @@ public:
 	virtual void PreClearGraspAbility_Implementation(TSubclassOf<UGameplayAbility> InAbility,
 		const UGraspData* GraspData, FGraspAbilityData& InAbilityData);
 
+	/**
+	 * Extension point called once per scan with the abilities it gave and cleared, see bBatchAbilityNotifications
+	 * Called after the scan is processed, so cleared abilities are already removed or parked
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category=Grasp)
+	void GraspAbilitiesChanged(const TArray<FGraspAbilityChange>& Changes);
+
+	virtual void GraspAbilitiesChanged_Implementation(const TArray<FGraspAbilityChange>& Changes);
+
 	/** Extension point called before trying to activate the grasp ability */
 	virtual void PreTryActivateGraspAbility(const AActor* SourceActor, UPrimitiveComponent* GraspableComponent,
 		EGraspAbilityComponentSource Source, FGameplayAbilitySpec* InSpec);
@@ -257,6 +437,66 @@ public:
 		EndTargetingRequests(FGameplayTag::EmptyTag, bNotifyGrasp);
 	}
 
+	/**
+	 * Start scanning locally at LocalScanInterval to drive UI and highlighting
+	 * Only runs on the local controller, called by InitializeGrasp() if bEnableLocalScan is true
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void StartLocalScan();
+
+	/** Stop the local scan and clear its results */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void StopLocalScan();
+
+	UFUNCTION(BlueprintPure, Category=Grasp)
+	bool IsLocalScanActive() const;
+
+	/**
+	 * Results of the last completed local scan
+	 * Sorted with interactable results first, then by distance, or highlight distance for highlight results
+	 */
+	UFUNCTION(BlueprintPure, Category=Grasp)
+	const TArray<FGraspLocalScanResult>& GetLocalScanResults() const { return LocalScanResults; }
+
+	/**
+	 * Whether the graspable's ability is granted, requires bEnableClientMirror
+	 * On the owning client this is the server's granted set, or the local prediction until MirrorPredictionTimeout
+	 */
+	UFUNCTION(BlueprintPure, Category=Grasp)
+	bool IsGraspableAbilityGranted(const UPrimitiveComponent* GraspableComponent) const;
+
+protected:
+	/** Predict whether the server will grant the graspable's ability, using the same grant logic */
+	bool PredictGraspableAbilityGranted(const UPrimitiveComponent* GraspableComponent, float NormalizedScanDistance) const;
+
+	/** @return True if we granted the ability and it isn't parked, as checked by GraspTargetsReady() before the grant distance */
+	bool HasUnparkedGraspAbility(TSubclassOf<UGameplayAbility> InAbility) const;
+
+	/** Send the owning client the granted graspables that differ from the state it last acknowledged */
+	void SendMirrorCorrections();
+
+	/** Apply the corrections to the baseline they were made against, and acknowledge the result */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceiveMirrorCorrections(const FGraspMirrorCorrections& Corrections);
+
+	/** The owning client holds the state at this sequence, or 0 if it lost the baseline and needs everything */
+	UFUNCTION(Server, Unreliable)
+	void ServerAckMirrorCorrections(uint16 Sequence);
+
+	/** Refresh bAbilityGranted on the local scan results, @return True if any changed */
+	bool UpdateLocalScanGrantedState();
+
+protected:
+	/** Start the local scan's targeting requests */
+	void RequestLocalScan();
+
+	/** Callback for each preset's local scan targeting request */
+	void OnLocalScanComplete(FTargetingRequestHandle TargetingHandle, FGameplayTag ScanTag);
+
+	/** End any in-progress local scan targeting requests */
+	void EndLocalTargetingRequests();
+
+public:
 	/**
 	 * Check if the granted gameplay ability is currently in range
 	 * This means if we clear the ability, it will be re-granted next frame
@@ -303,9 +543,21 @@ public:
 	void ClearAllGrantedGameplayAbilities(bool bClearCommonAbilities = false, bool bClearAbilitiesInRange = false,
 		bool bClearLockedAbilities = false, bool bClearScanAbility = false, bool bEmptyData = false);
 
+	/** @return True if the ability is parked, granted but unavailable until it is back in range */
+	UFUNCTION(BlueprintPure, Category=Grasp)
+	bool IsGraspAbilityParked(TSubclassOf<UGameplayAbility> Ability) const;
+
+protected:
+	/** Keep the ability granted but unavailable, clearing the least recently parked ability if there are too many */
+	void ParkGraspAbility(TSubclassOf<UGameplayAbility> Ability, FGraspAbilityData& Data);
+
+	/** Make a parked ability available again */
+	void UnparkGraspAbility(TSubclassOf<UGameplayAbility> Ability, FGraspAbilityData& Data);
+
 public:
 	/**
 	 * This component's ability cannot be cleared until ability lock is removed
+	 * Each lock added must be removed, or the graspable destroyed, before the ability can be cleared
 	 * @return True if the ability lock was added
 	 */
 	UFUNCTION(BlueprintCallable, Category=Grasp)
@@ -313,10 +565,24 @@ public:
 
 	/**
 	 * Remove ability lock for this component so it's ability can now be cleared
+	 * Locks are counted, the ability can be cleared once every lock has been removed
 	 * @return True if the ability lock was removed
 	 */
 	UFUNCTION(BlueprintCallable, Category=Grasp)
 	bool RemoveAbilityLock(const UPrimitiveComponent* GraspableComponent);
+
+protected:
+	/** @return True if any graspable still holds a lock on the ability */
+	bool IsAbilityLocked(const FGraspAbilityData& Data) const;
+
+	/** Clear the ability once its last lock is released, unless it is still in range */
+	void ClearUnlockedAbility(TSubclassOf<UGameplayAbility> InAbility, const UGraspData* GraspData);
+
+	/** Release any ability locks held by the graspable if it is being destroyed */
+	void OnGraspableUnregistered(const UPrimitiveComponent* GraspableComponent);
+
+	/** Release any ability locks held by graspables that were garbage collected without unregistering */
+	void OnPostGarbageCollect();
 	
 protected:
 	UFUNCTION(BlueprintCallable, Category=Grasp)
@@ -32,6 +32,7 @@ public:
 		, NormalizedGrantAbilityDistance(0.7f)
 		, AuthNetToleranceAnglePct(10.f)
 		, AuthNetToleranceDistancePct(10.f)
+		, MaxConcurrentInteractors(0)
 		, bManualClearAbility(false)
 		, bGrantAbilityDistance2D(false)
 		, bGraspDistance2D(false)
@@ -128,6 +129,14 @@ public:
 	 */
 	float GetAuthNetToleranceDistanceScalar() const { return 1.f + (AuthNetToleranceDistancePct / 100.f); }
 
+	/**
+	 * Maximum number of interactors that can claim this at once, see UGraspSubsystem::ClaimGraspable
+	 * Requests with bExcludeFullyReserved skip graspables that are fully claimed
+	 * Set to 0 for unlimited
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp, meta=(UIMin="0", ClampMin="0"))
+	int32 MaxConcurrentInteractors;
+
 	/** If true, abilities will not automatically be cleared when distance exceeds MaxGraspDistance */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp)
 	bool bManualClearAbility;
@@ -151,7 +160,25 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp)
 	FGameplayTag InputTag;
-	
+
+	/**
+	 * InputTag wrapped in a container, used to evaluate tag queries without building a container each time
+	 * Empty if InputTag is not set
+	 */
+	const FGameplayTagContainer& GetInputTagContainer() const { return InputTagContainer; }
+
+protected:
+	/** Cached container holding only InputTag */
+	UPROPERTY(Transient)
+	FGameplayTagContainer InputTagContainer;
+
+	/** Rebuild InputTagContainer from InputTag */
+	void CacheInputTagContainer();
+
+public:
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
 	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
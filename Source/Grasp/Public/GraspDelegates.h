@@ -14,11 +14,19 @@ class UGraspData;
 DECLARE_DELEGATE_OneParam(FOnPauseGrasp, bool /* bIsPaused */);
 DECLARE_DELEGATE(FOnRequestGrasp);
 
+UDELEGATE()
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGraspLocalScanUpdated, UGraspComponent*, GraspComponent,
+	const TArray<FGraspLocalScanResult>&, Results);
+
 UDELEGATE()
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FOnPostGiveGraspAbility, UGraspComponent*, GraspComponent,
 	TSubclassOf<UGameplayAbility>, Ability, const UPrimitiveComponent*, GraspableComponent,
 	const UGraspData*, GraspData, const FGraspAbilityData&, AbilityData);
 
+UDELEGATE()
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGraspAbilitiesChanged, UGraspComponent*, GraspComponent,
+	const TArray<FGraspAbilityChange>&, Changes);
+
 UDELEGATE()
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnPostGiveCommonGraspAbility, UGraspComponent*, GraspComponent,
 	TSubclassOf<UGameplayAbility>, Ability, const FGraspAbilityData&, AbilityData);
@@ -47,4 +47,27 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, Config, AdvancedDisplay, Category=Grasp)
 	bool bDisableScanTaskAbilityErrorChecking = false;
+
+	/**
+	 * Number of interaction slots UGraspSubsystem places around each graspable for AI, spread across the valid angle
+	 * 0 to disable interaction slots
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Grasp|Interaction Slots", meta=(UIMin="0", ClampMin="0", UIMax="16"))
+	int32 InteractionSlotCount = 8;
+
+	/** How far into the valid angle range slots are spread (0.0 = all facing the forward, 1.0 = out to MaxGraspAngle) */
+	UPROPERTY(EditAnywhere, Config, Category="Grasp|Interaction Slots", meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1"))
+	float InteractionSlotAngleAlpha = 0.9f;
+
+	/** How far into the valid distance range slots are placed (0.0 = at the graspable, 1.0 = at MaxGraspDistance) */
+	UPROPERTY(EditAnywhere, Config, Category="Grasp|Interaction Slots", meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1"))
+	float InteractionSlotDistanceAlpha = 0.7f;
+
+	/** Extent used to project slots onto the NavMesh */
+	UPROPERTY(EditAnywhere, Config, Category="Grasp|Interaction Slots")
+	FVector InteractionSlotProjectionExtent = FVector(50.f, 50.f, 250.f);
+
+	/** If true, slots are built when a graspable registers instead of the first time they are requested */
+	UPROPERTY(EditAnywhere, Config, Category="Grasp|Interaction Slots")
+	bool bBuildInteractionSlotsOnRegister = false;
 };
@@ -0,0 +1,85 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetUserData.h"
+#include "GraspLevelIndex.generated.h"
+
+/**
+ * Format of the baked graspable index
+ * Levels baked with any other version are discarded on load and must be rebaked with the GraspBakeIndex commandlet
+ */
+struct GRASP_API FGraspLevelIndexVersion
+{
+	enum Type : int32
+	{
+		/** Baked before the index was versioned */
+		BeforeCustomVersionWasAdded = 0,
+
+		/** Entries only store bounds */
+		BoundsOnlyEntries,
+
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	static const FGuid GUID;
+};
+
+/**
+ * Baked spatial data for a single graspable component
+ * Plain data so the whole array can be bulk serialized
+ */
+struct FGraspBakedEntry
+{
+	FVector3f BoundsOrigin = FVector3f::ZeroVector;
+	float BoundsRadius = 0.f;
+
+	friend FArchive& operator<<(FArchive& Ar, FGraspBakedEntry& Entry)
+	{
+		Ar << Entry.BoundsOrigin;
+		Ar << Entry.BoundsRadius;
+		return Ar;
+	}
+};
+
+/**
+ * Graspable index baked into a level by the GraspBakeIndex commandlet
+ * Stored as asset user data on the ULevel so it streams in with the level
+ *
+ * Covers graspables that were placed in the level with Static mobility; UGraspSubsystem uses it
+ * to skip registering those components at runtime, and only resolves them when a query reaches them
+ */
+UCLASS()
+class GRASP_API UGraspLevelIndex : public UAssetUserData
+{
+	GENERATED_BODY()
+
+public:
+	/** Baked entries, bulk serialized */
+	TArray<FGraspBakedEntry> Entries;
+
+	/** Owning actor name for each entry, used to resolve the component */
+	UPROPERTY()
+	TArray<FName> ActorNames;
+
+	/** Component name for each entry, used to resolve the component */
+	UPROPERTY()
+	TArray<FName> ComponentNames;
+
+	/** @return Number of baked graspables */
+	int32 Num() const { return Entries.Num(); }
+
+	/** Find the baked component in the level that owns this index */
+	UPrimitiveComponent* ResolveComponent(const ULevel* Level, int32 EntryIndex) const;
+
+	/** @return Index of the baked entry for the component, or INDEX_NONE if it was added after baking */
+	int32 FindEntry(const UPrimitiveComponent* Component) const;
+
+	virtual void Serialize(FArchive& Ar) override;
+
+protected:
+	/** Entry index for each actor and component name pair, built the first time FindEntry() is called */
+	mutable TMap<TPair<FName, FName>, int32> EntryLookup;
+};
@@ -7,6 +7,7 @@
 #include "Templates/SubclassOf.h"
 #include "GraspRequestTypes.generated.h"
 
+class AActor;
 class UGraspData;
 
 /**
@@ -32,6 +33,48 @@ struct GRASP_API FGraspRequestFilter
 	/** If true, include graspables with no GraspAbility set. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp)
 	bool bIncludeWithoutAbility = false;
+
+	/** If true, skip graspables whose claims have reached UGraspData::MaxConcurrentInteractors. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp)
+	bool bExcludeFullyReserved = false;
+
+	/** Claims held by this actor don't count toward bExcludeFullyReserved, so it still finds what it has claimed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp, meta = (EditCondition = "bExcludeFullyReserved"))
+	TObjectPtr<AActor> Claimant = nullptr;
+};
+
+/**
+ * FGraspRequestFilter compiled once per request.
+ * The tag query is evaluated once per unique InputTag and the result cached,
+ * so matching a GraspData entry neither allocates nor walks the query again.
+ *
+ * Compile() must be called on the game thread. Once every GraspData has been compiled,
+ * Matches() only reads cached state and is safe to call from worker threads.
+ */
+struct GRASP_API FGraspRequestFilterMatcher
+{
+	explicit FGraspRequestFilterMatcher(const FGraspRequestFilter& InFilter);
+
+	/** Resolve the tag query for this GraspData's InputTag. */
+	void Compile(const UGraspData* GraspData);
+
+	/** @return True if the GraspData passes the class and tag requirements. */
+	bool Matches(const UGraspData* GraspData) const;
+
+private:
+	/** @return True if the tag requirements pass for this GraspData, evaluating the query if the tag was never compiled. */
+	bool MatchesTag(const UGraspData* GraspData) const;
+
+	const FGraspRequestFilter& Filter;
+
+	/** Tags that have been compiled, each with a bit in TagResults. */
+	TMap<FGameplayTag, int32> CompiledTags;
+
+	/** Query result for each compiled tag. */
+	TBitArray<> TagResults;
+
+	/** True if the filter has no tag requirements, every tag passes. */
+	bool bMatchAnyTag = true;
 };
 
 /**
@@ -60,6 +103,13 @@ struct GRASP_API FGraspRequest
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp)
 	bool bUseSphere = false;
 
+	/**
+	 * If true, search the graspable index maintained by UGraspSubsystem instead of running a physics overlap.
+	 * Graspables are tested by their bounding sphere, and the Grasp collision settings are ignored.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp)
+	bool bUseGraspableIndex = false;
+
 	/** Filter criteria. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp)
 	FGraspRequestFilter Filter;
@@ -105,3 +155,90 @@ struct GRASP_API FGraspRequestResult
 		return !(*this == Other);
 	}
 };
+
+/**
+ * Handle to a standing query registered with UGraspSubsystem.
+ */
+USTRUCT(BlueprintType)
+struct GRASP_API FGraspStandingQueryHandle
+{
+	GENERATED_BODY()
+
+	FGraspStandingQueryHandle() = default;
+
+	explicit FGraspStandingQueryHandle(int32 InHandle)
+		: Handle(InHandle)
+	{}
+
+	bool IsValid() const { return Handle != INDEX_NONE; }
+	void Invalidate() { Handle = INDEX_NONE; }
+
+	UPROPERTY()
+	int32 Handle = INDEX_NONE;
+
+	bool operator==(const FGraspStandingQueryHandle& Other) const { return Handle == Other.Handle; }
+	bool operator!=(const FGraspStandingQueryHandle& Other) const { return Handle != Other.Handle; }
+
+	friend uint32 GetTypeHash(const FGraspStandingQueryHandle& InHandle) { return ::GetTypeHash(InHandle.Handle); }
+};
+
+/**
+ * A request that stays registered with UGraspSubsystem and follows an actor.
+ * The query volume is relative to the follow actor: QuerySphereCenter and QueryBox are treated as offsets from its location.
+ */
+USTRUCT(BlueprintType)
+struct GRASP_API FGraspStandingRequest
+{
+	GENERATED_BODY()
+
+	FGraspStandingRequest() = default;
+
+	/** Query volume, relative to the follow actor, and filter. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp)
+	FGraspRequest Request;
+
+	/**
+	 * Size of the cells used to detect movement.
+	 * The query only recomputes when the follow actor or one of its results moves into a different cell.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp, meta = (ClampMin = "1", UIMin = "1", ForceUnits = "cm"))
+	float CellSize = 100.f;
+
+	/** Minimum time between checking whether the query needs to recompute. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp, meta = (ClampMin = "0", UIMin = "0", ForceUnits = "s"))
+	float UpdateInterval = 0.1f;
+
+	/**
+	 * Maximum time before the query recomputes even if nothing moved across a cell.
+	 * Graspables registering or moving in the graspable index already refresh overlapping queries,
+	 * this catches anything that reaches the volume without going through the index.
+	 * Set to 0 to disable.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Grasp, meta = (ClampMin = "0", UIMin = "0", ForceUnits = "s"))
+	float MaxRefreshInterval = 1.f;
+};
+
+DECLARE_DELEGATE_TwoParams(FOnGraspStandingQueryResult, FGraspStandingQueryHandle /* Handle */, const FGraspRequestResult& /* Result */);
+DECLARE_DELEGATE_TwoParams(FOnGraspStandingQueryResults, FGraspStandingQueryHandle /* Handle */, const TArray<FGraspRequestResult>& /* Results */);
+
+UDELEGATE()
+DECLARE_DYNAMIC_DELEGATE_ThreeParams(FOnGraspStandingQueryChanged, FGraspStandingQueryHandle, Handle,
+	const TArray<FGraspRequestResult>&, Entered, const TArray<FGraspRequestResult>&, Exited);
+
+/**
+ * Callbacks for a standing query.
+ */
+struct GRASP_API FGraspStandingQueryDelegates
+{
+	/** Called for each result that entered the query volume. */
+	FOnGraspStandingQueryResult OnEnter;
+
+	/** Called for each result that left the query volume, or became invalid. */
+	FOnGraspStandingQueryResult OnExit;
+
+	/** Called once after any results entered or exited, with the full set of current results. */
+	FOnGraspStandingQueryResults OnChanged;
+
+	/** Blueprint callback, called once after any results entered or exited. */
+	FOnGraspStandingQueryChanged OnChangedDynamic;
+};
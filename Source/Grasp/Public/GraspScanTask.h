@@ -23,9 +23,6 @@ public:
 	UPROPERTY()
 	FTimerHandle GraspWaitTimer;
 
-	UPROPERTY()
-	FTimerHandle FailsafeTimer;
-
 protected:
 	UPROPERTY()
 	TWeakObjectPtr<UGraspComponent> GC;
@@ -69,6 +66,12 @@ public:
 	UFUNCTION()
 	void OnRequestGrasp();
 
+	/**
+	 * Called by the UGraspSubsystem watchdog
+	 * Retries if our targeting requests have been outstanding for longer than FailsafeDelay
+	 */
+	void RetryIfHung(double TimeSeconds);
+
 	virtual void OnDestroy(bool bInOwnerFinished) override;
 
 protected:
@@ -77,6 +80,12 @@ protected:
 
 	UPROPERTY()
 	float FailsafeDelay = 1.f;
+
+	/** World time when we last started targeting requests, used by the watchdog to detect hung requests */
+	double LastRequestTime = 0.0;
+
+	/** Scratch buffer for the results of each scan, keeps its capacity between scans */
+	TArray<FGraspScanResult> ScanResults;
 	
 	ENetMode GetOwnerNetMode() const;
 	FString GetRoleString() const;
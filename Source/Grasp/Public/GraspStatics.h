@@ -194,6 +194,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Grasp, meta=(Keywords="grasp"))
 	static EGraspCardinal_8Way GetCardinalDirectionFromAngle_8Way(float Angle);
 
+	/** Batched GetCardinalDirectionFromAngle_4Way, OutCardinals must be the same length as Angles */
+	static void GetCardinalDirectionsFromAngles_4Way(TConstArrayView<float> Angles, TArrayView<EGraspCardinal_4Way> OutCardinals);
+
+	/** Batched GetCardinalDirectionFromAngle_8Way, OutCardinals must be the same length as Angles */
+	static void GetCardinalDirectionsFromAngles_8Way(TConstArrayView<float> Angles, TArrayView<EGraspCardinal_8Way> OutCardinals);
+
 	/**
 	 * Convert the given direction to an angle to later convert to a cardinal
 	 * @see GetCardinalDirectionFromAngle_4Way
@@ -212,6 +218,22 @@ public:
 	static EGraspCardinal_8Way CalculateCardinalDirection_8Way(const FVector& SourceLocation,
 		const FRotator& SourceRotation, const FVector& TargetLocation);
 
+	/**
+	 * Batched CalculateCardinalDirection_4Way, e.g. for a crowd selecting interaction animations
+	 * Outputs one cardinal per source, arrays should be the same length
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp, meta=(Keywords="grasp"))
+	static void CalculateCardinalDirections_4Way(const TArray<FVector>& SourceLocations,
+		const TArray<FRotator>& SourceRotations, const TArray<FVector>& TargetLocations, TArray<EGraspCardinal_4Way>& OutCardinals);
+
+	/**
+	 * Batched CalculateCardinalDirection_8Way, e.g. for a crowd selecting interaction animations
+	 * Outputs one cardinal per source, arrays should be the same length
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp, meta=(Keywords="grasp"))
+	static void CalculateCardinalDirections_8Way(const TArray<FVector>& SourceLocations,
+		const TArray<FRotator>& SourceRotations, const TArray<FVector>& TargetLocations, TArray<EGraspCardinal_8Way>& OutCardinals);
+
 	/** Get the opposite cardinal direction */
 	UFUNCTION(BlueprintPure, Category=Grasp, meta=(Keywords="grasp"))
 	static EGraspCardinal_4Way GetOppositeCardinalDirection_4Way(EGraspCardinal_4Way Cardinal);
@@ -355,6 +377,21 @@ public:
 		float& NormalizedAngleDiff, float& NormalizedDistance, float& NormalizedHighlightDistance,
 		int32 GraspDataIndex = 0);
 
+	/**
+	 * Check if the Interactor is within angle, distance and height to the Interactable
+	 * Same semantics as CanInteractWith, but operates on plain data so it is safe to call off the game thread
+	 * @param InteractorLocation The location of the interactor
+	 * @param GraspableLocation The location of the graspable (interactable) component
+	 * @param GraspableForward The forward vector of the graspable (interactable) component
+	 * @param Params Range parameters copied from the GraspData, including any auth net tolerance
+	 * @param NormalizedAngleDiff The normalized angle difference between the interactor and the graspable
+	 * @param NormalizedDistance The normalized distance between the interactor and the graspable
+	 * @param NormalizedHighlightDistance The normalized highlight distance between the interactor and the graspable
+	 */
+	static EGraspQueryResult CanInteractWithParams(const FVector& InteractorLocation, const FVector& GraspableLocation,
+		const FVector& GraspableForward, const FGraspInteractParams& Params,
+		float& NormalizedAngleDiff, float& NormalizedDistance, float& NormalizedHighlightDistance);
+
 	/**
 	 * Check if the Interactor is within distance to the Interactable
 	 * @param Interactor The interactor actor
@@ -407,6 +444,41 @@ public:
 		const UPrimitiveComponent* GraspableComponent, FVector& OutLocation,
 		int32 GraspDataIndex = 0, float AngleAlpha = 1.f, float DistanceAlpha = 1.f);
 
+	/**
+	 * Batched GetInteractionLocationForGraspable for every interactor against every graspable.
+	 * Each graspable's data, location and cone edges are gathered once instead of once per interactor.
+	 * Results are laid out per interactor: [InteractorIndex * GraspableComponents.Num() + GraspableIndex]
+	 *
+	 * @param InteractorLocations The current location of each NPC
+	 * @param GraspableComponents The components to interact with
+	 * @param OutLocations The computed world-space location for each pair (only valid when the result is NeedsToMove)
+	 * @param OutResults Failed, AlreadyInRange, or NeedsToMove for each pair
+	 * @see GetInteractionLocationForGraspable
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	static void GetInteractionLocationsForGraspables(const TArray<FVector>& InteractorLocations,
+		const TArray<UPrimitiveComponent*>& GraspableComponents, TArray<FVector>& OutLocations,
+		TArray<EGraspInteractionLocationResult>& OutResults,
+		int32 GraspDataIndex = 0, float AngleAlpha = 1.f, float DistanceAlpha = 1.f);
+
+	/**
+	 * For each interactor, find the graspable that is cheapest to reach, i.e. with the closest interaction location.
+	 * A graspable the interactor is already in range of costs nothing.
+	 * Outputs have one entry per interactor, OutGraspableIndices is INDEX_NONE and the result Failed if none were valid.
+	 *
+	 * @param InteractorLocations The current location of each NPC
+	 * @param GraspableComponents The components to interact with
+	 * @param OutGraspableIndices Index into GraspableComponents of the cheapest graspable for each interactor
+	 * @param OutLocations The computed world-space location for each interactor
+	 * @param OutResults Failed, AlreadyInRange, or NeedsToMove for each interactor
+	 * @see GetInteractionLocationForGraspable
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	static void GetCheapestInteractionLocations(const TArray<FVector>& InteractorLocations,
+		const TArray<UPrimitiveComponent*>& GraspableComponents, TArray<int32>& OutGraspableIndices,
+		TArray<FVector>& OutLocations, TArray<EGraspInteractionLocationResult>& OutResults,
+		int32 GraspDataIndex = 0, float AngleAlpha = 1.f, float DistanceAlpha = 1.f);
+
 	/**
 	 * Get the normalized distance between interact and highlight distances
 	 * @param GraspData The grasp data
@@ -427,6 +499,26 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Grasp)
 	static FVector2D GetScreenPositionForGraspableComponent(const UPrimitiveComponent* GraspableComponent,
 		APlayerController* PlayerController, bool& bSuccess, const UWidget* Widget = nullptr);
+
+	/**
+	 * Project the local scan results to the screen in one pass and rank them for choosing interaction prompts
+	 * The view projection is computed once, results behind the camera or off-screen are culled
+	 * Ranked by distance from the screen center, blended with NormalizedScanDistance by DistanceWeight
+	 * UI Helper to choose which prompt to show with one call per frame
+	 * @param PlayerController The local player controller whose view is used
+	 * @param Results Local scan results, typically UGraspComponent::GetLocalScanResults()
+	 * @param OutCandidates Ranked candidates, best first
+	 * @param MaxCandidates Maximum number of candidates to return, 0 for no limit
+	 * @param DistanceWeight 0 ranks by screen center only, 1 ranks by NormalizedScanDistance only
+	 * @param bPreferInteractable If true, results that can be interacted with are ranked before those that can only be highlighted
+	 * @param bRequireRecentlyRendered If true, cull graspables that were not rendered recently, e.g. occluded
+	 * @param ScreenMargin Fraction of the view size that candidates must be inside the screen edge by
+	 * @return True if any candidates were found
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp, meta=(AdvancedDisplay="bPreferInteractable,bRequireRecentlyRendered,ScreenMargin"))
+	static bool GetGraspScreenCandidates(APlayerController* PlayerController, const TArray<FGraspLocalScanResult>& Results,
+		TArray<FGraspScreenCandidate>& OutCandidates, int32 MaxCandidates = 3, float DistanceWeight = 0.5f,
+		bool bPreferInteractable = true, bool bRequireRecentlyRendered = false, float ScreenMargin = 0.f);
 };
 
 template <typename T>
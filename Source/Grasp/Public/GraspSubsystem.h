@@ -4,22 +4,357 @@
 
 #include "CoreMinimal.h"
 #include "GraspRequestTypes.h"
+#include "Engine/EngineTypes.h"
 #include "Types/TargetingSystemTypes.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "GraspSubsystem.generated.h"
 
+class ANavigationData;
+class UGraspLevelIndex;
+class UGraspScanTask;
+struct FRootMotionSource_GraspFaceTowards;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnGraspableUnregistered, const UPrimitiveComponent* /* Component */);
+
 /**
  * World subsystem providing spatial search for graspable components.
  * Mirrors USmartObjectSubsystem's FindSmartObjects API pattern for AI integration.
  *
  * Uses physics overlap queries against the Grasp collision channel/profile
  * to find graspable components, then filters by GraspData properties.
+ *
+ * Graspable components register themselves with an index that is chunked per level,
+ * so streaming levels (including World Partition cells) attach and detach their graspables as a unit.
+ * Levels baked with the GraspBakeIndex commandlet attach their static graspables without registering each component.
+ *
+ * Standing queries can be registered to follow an actor and report graspables entering and leaving their volume.
+ * These only recompute when the follow actor or a result moves across a cell, instead of every tick.
+ *
+ * Active scan tasks register with a single watchdog that retries any scan whose targeting requests have hung.
+ *
+ * Interaction slots are cached per graspable and GraspData entry: positions around the valid angle and distance,
+ * projected onto the NavMesh once and rebuilt when navigation finishes generating or the graspable moves.
+ * AI occupy slots so they don't crowd the same point.
+ *
+ * Interactors can claim a graspable's GraspData entry up to its MaxConcurrentInteractors, and requests can skip
+ * fully claimed graspables instead of every AI pathing to the same closest one.
  */
 UCLASS()
-class GRASP_API UGraspSubsystem : public UWorldSubsystem
+class GRASP_API UGraspSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
+protected:
+	/** Internal state of a registered standing query. */
+	struct FGraspStandingQuery
+	{
+		FGraspStandingRequest StandingRequest;
+		TWeakObjectPtr<const AActor> FollowActor;
+		FGraspStandingQueryDelegates Delegates;
+
+		/** Results from the last recompute. */
+		TArray<FGraspRequestResult> Results;
+
+		/** Cell of each result at the last recompute, matches the order of Results. */
+		TArray<FIntVector> ResultCells;
+
+		/** Cell of the follow actor at the last recompute. */
+		FIntVector FollowCell = FIntVector::ZeroValue;
+
+		/** World space bounds of the query volume at the last recompute. */
+		FBox QueryBounds = FBox(ForceInit);
+
+		double LastUpdateTime = -DBL_MAX;
+		double LastRefreshTime = -DBL_MAX;
+		bool bHasRefreshed = false;
+
+		/** A graspable registered or moved into the query volume since the last recompute. */
+		bool bDirty = false;
+	};
+
+	/** Standing queries mapped by their handle. */
+	TMap<FGraspStandingQueryHandle, FGraspStandingQuery> StandingQueries;
+
+	/** Last handle that was assigned. */
+	int32 LastStandingQueryHandle = 0;
+
+	/** Cached spatial data for a graspable component in the index. */
+	struct FGraspIndexEntry
+	{
+		TObjectKey<UPrimitiveComponent> Key;
+
+		/** Baked entries are resolved the first time a query reaches them. */
+		mutable TWeakObjectPtr<UPrimitiveComponent> Component;
+
+		FSphere Bounds = FSphere(ForceInit);
+
+		/** Index into the level's UGraspLevelIndex, if this entry was baked. */
+		int32 BakedIndex = INDEX_NONE;
+	};
+
+	/**
+	 * Graspables belonging to a single level.
+	 * Streaming levels and World Partition cells each have their own chunk, so attaching or detaching one
+	 * only touches its own graspables.
+	 */
+	struct FGraspIndexChunk
+	{
+		TArray<FGraspIndexEntry> Entries;
+
+		/** Index into Entries for each component. */
+		TMap<TObjectKey<UPrimitiveComponent>, int32> EntryIndices;
+
+		/** Bounds of every entry in the chunk, only grows until the chunk is rebuilt. */
+		FBox Bounds = FBox(ForceInit);
+
+		/** The level this chunk belongs to. */
+		TWeakObjectPtr<ULevel> Level;
+
+		/** Index baked into the level, if any. Components it covers never register at runtime. */
+		TWeakObjectPtr<const UGraspLevelIndex> BakedIndex;
+
+		/** True once we have warned that the baked index is missing graspables. */
+		bool bWarnedStaleBake = false;
+
+		/** Add the entries baked into the level. */
+		void AddBaked(const UGraspLevelIndex* InBakedIndex);
+
+		/** @return The entry's component, resolving it from the baked index if needed. */
+		UPrimitiveComponent* Resolve(const FGraspIndexEntry& Entry) const;
+
+		void Add(UPrimitiveComponent* Component, const FSphere& EntryBounds);
+		void Remove(const UPrimitiveComponent* Component);
+		void Update(const UPrimitiveComponent* Component, const FSphere& EntryBounds);
+	};
+
+	/** Graspable index chunks mapped by the level they belong to. */
+	TMap<TObjectKey<ULevel>, FGraspIndexChunk> IndexChunks;
+
+	/** Chunk each indexed component was added to. */
+	TMap<TObjectKey<UPrimitiveComponent>, TObjectKey<ULevel>> IndexedComponentLevels;
+
+	FDelegateHandle LevelAddedToWorldHandle;
+	FDelegateHandle LevelRemovedFromWorldHandle;
+
+	/** Scan tasks swept by the watchdog. */
+	TArray<TWeakObjectPtr<UGraspScanTask>> Scanners;
+
+	/** Looping timer that sweeps the scanners, only active while any are registered. */
+	FTimerHandle ScanWatchdogTimer;
+
+	/** Face towards root motion sources kept for reuse, shared with movement components while applied. */
+	TArray<TSharedPtr<FRootMotionSource_GraspFaceTowards>> FaceTowardsPool;
+
+	/** A cached interaction slot and the actor occupying it. */
+	struct FGraspInteractionSlot
+	{
+		FVector Location = FVector::ZeroVector;
+		TWeakObjectPtr<const AActor> Occupant;
+
+		/** False if the slot couldn't be projected to navigation, it keeps its index but can't be occupied. */
+		bool bValid = false;
+	};
+
+	/** Interaction slots for a single GraspData entry. */
+	struct FGraspInteractionSlotSet
+	{
+		/** One entry per InteractionSlotCount, so slot indices stay stable across rebuilds. */
+		TArray<FGraspInteractionSlot> Slots;
+
+		/** Graspable transform the slots were built from, they are rebuilt if it moves. */
+		FTransform GraspableTransform = FTransform::Identity;
+
+		bool bBuilt = false;
+	};
+
+	/** Interaction slots for each graspable, indexed by GraspData index. */
+	TMap<TObjectKey<UPrimitiveComponent>, TArray<FGraspInteractionSlotSet, TInlineAllocator<1>>> InteractionSlots;
+
+	/** Actors holding a claim on a single GraspData entry. */
+	using FGraspClaimants = TArray<TWeakObjectPtr<const AActor>, TInlineAllocator<2>>;
+
+	/** Claims for each graspable, indexed by GraspData index. */
+	TMap<TObjectKey<UPrimitiveComponent>, TArray<FGraspClaimants, TInlineAllocator<1>>> Reservations;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return StandingQueries.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Register a query that follows an actor and reports graspables entering and leaving its volume.
+	 * @param StandingRequest Query volume, relative to FollowActor, and how often it is updated
+	 * @param FollowActor Actor the query volume follows. The query is unregistered when this is destroyed.
+	 * @param Delegates Callbacks for results entering or leaving the volume
+	 * @return Handle used to unregister the query, or an invalid handle if it could not be registered.
+	 */
+	FGraspStandingQueryHandle RegisterStandingQuery(const FGraspStandingRequest& StandingRequest, const AActor* FollowActor,
+		const FGraspStandingQueryDelegates& Delegates);
+
+	/**
+	 * Register a query that follows an actor and reports graspables entering and leaving its volume.
+	 * @return Handle used to unregister the query, or an invalid handle if it could not be registered.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp", meta = (DisplayName = "Register Standing Query"))
+	FGraspStandingQueryHandle K2_RegisterStandingQuery(const FGraspStandingRequest& StandingRequest, const AActor* FollowActor,
+		FOnGraspStandingQueryChanged OnChanged);
+
+	/**
+	 * Unregister a standing query. Does not call OnExit for its current results.
+	 * @return True if the query was registered.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	bool UnregisterStandingQuery(UPARAM(ref) FGraspStandingQueryHandle& Handle);
+
+	/**
+	 * Get the current results of a standing query.
+	 * @return True if the query is registered.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	bool GetStandingQueryResults(FGraspStandingQueryHandle Handle, TArray<FGraspRequestResult>& OutResults) const;
+
+	/**
+	 * Add a graspable component to the index of the level it belongs to.
+	 * Called by the graspable components when they are registered; only game worlds are indexed.
+	 */
+	static void RegisterGraspable(UPrimitiveComponent* Component);
+
+	/** Remove a graspable component from the index. Called by the graspable components when they are unregistered. */
+	static void UnregisterGraspable(UPrimitiveComponent* Component);
+
+	/** Called when a graspable component is unregistered, so anything keyed by it can be released. */
+	FOnGraspableUnregistered OnGraspableUnregistered;
+
+	/**
+	 * Find indexed graspables whose bounds overlap the sphere.
+	 * Only chunks whose bounds overlap the sphere are visited.
+	 */
+	void QueryGraspableIndex(const FVector& Center, float Radius, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+	/**
+	 * Find indexed graspables whose bounds overlap the box.
+	 * Only chunks whose bounds overlap the box are visited.
+	 */
+	void QueryGraspableIndex(const FBox& Box, TArray<UPrimitiveComponent*>& OutComponents) const;
+
+	/** @return Number of graspables in the index, including baked graspables. */
+	int32 GetNumIndexedGraspables() const;
+
+	/**
+	 * Add a scan task to the watchdog, which retries it if its targeting requests are outstanding for longer
+	 * than its FailsafeDelay.
+	 */
+	void RegisterScanner(UGraspScanTask* Scanner);
+
+	/** Remove a scan task from the watchdog. */
+	void UnregisterScanner(UGraspScanTask* Scanner);
+
+	/** @return A face towards root motion source from the pool that is no longer applied to any movement component, or a new one. */
+	TSharedPtr<FRootMotionSource_GraspFaceTowards> AcquireFaceTowardsRootMotionSource();
+
+	/**
+	 * Get the cached interaction slots for a graspable, building them if needed.
+	 * Slots that couldn't be projected to navigation are skipped, use FindInteractionSlot() for a slot index.
+	 * @return True if the graspable has any slots.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	bool GetInteractionSlots(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, TArray<FVector>& OutSlots);
+
+	/**
+	 * Find the closest interaction slot that isn't occupied by another actor.
+	 * @param Interactor The actor that wants to interact, slots it already occupies are considered free
+	 * @return True if a free slot was found.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	bool FindInteractionSlot(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Interactor,
+		FVector& OutLocation, int32& OutSlotIndex);
+
+	/**
+	 * Occupy an interaction slot, releasing any other slot the occupant holds on the same GraspData entry.
+	 * @return True if the slot was free or already occupied by this actor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	bool OccupyInteractionSlot(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, int32 SlotIndex, const AActor* Occupant);
+
+	/** Release any interaction slot the occupant holds on the graspable's GraspData entry. */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	void ReleaseInteractionSlot(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Occupant);
+
+	/**
+	 * Claim a graspable's GraspData entry for an interactor, up to UGraspData::MaxConcurrentInteractors.
+	 * Claims are released when the claimant or the graspable is destroyed.
+	 * @return True if claimed, or already claimed by this actor.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	bool ClaimGraspable(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Claimant);
+
+	/** Release a claim on a graspable's GraspData entry. */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	void ReleaseGraspable(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* Claimant);
+
+	/** Release every claim held by an actor. */
+	UFUNCTION(BlueprintCallable, Category = "Grasp")
+	void ReleaseAllGraspableClaims(const AActor* Claimant);
+
+	/** @return Number of actors holding a claim on a graspable's GraspData entry. */
+	UFUNCTION(BlueprintPure, Category = "Grasp")
+	int32 GetNumGraspableClaims(const UPrimitiveComponent* Graspable, int32 GraspDataIndex) const;
+
+	/**
+	 * @param IgnoreClaimant Claims held by this actor are not counted
+	 * @return True if the claims on a graspable's GraspData entry have reached its MaxConcurrentInteractors.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Grasp")
+	bool IsGraspableFullyReserved(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, const AActor* IgnoreClaimant = nullptr) const;
+
+protected:
+	/** Find or create the chunk for a level, adding any entries baked into the level. */
+	FGraspIndexChunk& FindOrAddChunk(ULevel* Level);
+
+	void AddToIndex(UPrimitiveComponent* Component);
+	void RemoveFromIndex(UPrimitiveComponent* Component);
+
+	/** Keep movable graspables up to date in the index. */
+	void OnGraspableTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Attach the baked chunk for a level that streamed in. */
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+	/** Detach the chunk for a level that streamed out. */
+	void OnLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	/**
+	 * Remove state held for graspables that were garbage collected without being destroyed, e.g. streamed out.
+	 * Destroyed graspables are removed when they unregister.
+	 */
+	void PruneCollectedGraspables();
+
+	/** Retry every registered scanner whose targeting requests have hung. */
+	void OnScanWatchdog();
+
+	/** @return The graspable's slot set, rebuilt if it was invalidated or the graspable moved. Null if there is no GraspData. */
+	FGraspInteractionSlotSet* FindOrBuildInteractionSlots(const UPrimitiveComponent* Graspable, int32 GraspDataIndex);
+
+	/** Place slots around the graspable and project them onto the NavMesh, preserving occupants by slot index. */
+	void BuildInteractionSlots(const UPrimitiveComponent* Graspable, int32 GraspDataIndex, FGraspInteractionSlotSet& SlotSet) const;
+
+	/** Invalidate every interaction slot, they are rebuilt the next time they are requested. */
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+	/** @return True if the follow actor or any result moved across a cell, or the query is due a refresh. */
+	bool ShouldRefreshStandingQuery(const FGraspStandingQuery& Query, const FIntVector& FollowCell, double TimeSeconds) const;
+
+	/** Flag standing queries whose volume overlaps the bounds to recompute, unless the component is already a result. */
+	void MarkStandingQueriesDirty(const FBox& Bounds, const UPrimitiveComponent* Component = nullptr);
+
+	/** Recompute the query and notify its delegates of any changes. */
+	void RefreshStandingQuery(FGraspStandingQueryHandle Handle, FGraspStandingQuery& Query, const FVector& FollowLocation,
+		const FIntVector& FollowCell, double TimeSeconds);
+
 public:
 	/** Get the subsystem from any world context object. */
 	static UGraspSubsystem* Get(const UObject* WorldContextObject);
@@ -8,4 +8,5 @@ namespace FGraspTags
 {
 	GRASP_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Grasp_Interact);
 	GRASP_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Grasp_Interact_Activate);
+	GRASP_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Grasp_Ability_Parked);
 }
\ No newline at end of file
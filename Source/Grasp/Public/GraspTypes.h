@@ -7,6 +7,7 @@
 #include "GraspTypes.generated.h"
 
 class UGraspComponent;
+class UGraspData;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGrasp, Log, All);
 
@@ -135,4 +136,189 @@ struct GRASP_API FGraspScanResult
 		return !(*this == Other);
 	}
 };
+
+/**
+ * Result of the optional local scan that runs on the owning client, used to drive UI and highlighting
+ * One result per GraspData entry that can be highlighted or interacted with
+ */
+USTRUCT(BlueprintType)
+struct GRASP_API FGraspLocalScanResult
+{
+	GENERATED_BODY()
+
+	FGraspLocalScanResult()
+		: GraspDataIndex(0)
+		, QueryResult(EGraspQueryResult::None)
+		, NormalizedScanDistance(0.f)
+		, NormalizedAngleDiff(0.f)
+		, NormalizedDistance(0.f)
+		, NormalizedHighlightDistance(0.f)
+		, bAbilityGranted(false)
+	{}
+
+	/** Tag used for the targeting preset that discovered this interactable */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	FGameplayTag ScanTag;
+
+	/** The graspable component that can be highlighted or interacted with */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	TWeakObjectPtr<UPrimitiveComponent> Graspable;
+
+	/** Index of the GraspData on the graspable component */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	int32 GraspDataIndex;
+
+	/** Whether we can highlight or interact with the graspable */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	EGraspQueryResult QueryResult;
+
+	/** Normalized Distance between Avatar and Graspable location on a 0-1 scale, normalized between 0 and the max scan range */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	float NormalizedScanDistance;
+
+	/** Normalized angle difference between the interactor and the graspable, from UGraspStatics::CanInteractWith */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	float NormalizedAngleDiff;
+
+	/** Normalized distance between the interactor and the graspable, from UGraspStatics::CanInteractWith */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	float NormalizedDistance;
+
+	/** Normalized highlight distance between the interactor and the graspable, from UGraspStatics::CanInteractWith */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	float NormalizedHighlightDistance;
+
+	/**
+	 * Whether the graspable's ability is granted, predicted locally and corrected by the server
+	 * Only populated when UGraspComponent::bEnableClientMirror is true
+	 */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	bool bAbilityGranted;
+};
+
+/**
+ * Server corrections for the client mirror, the difference from a state the client acknowledged
+ * Graspables are sent as net IDs, with one bit each for whether their ability is granted
+ */
+USTRUCT()
+struct GRASP_API FGraspMirrorCorrections
+{
+	GENERATED_BODY()
+
+	/** Sequence of the server's granted set once applied */
+	UPROPERTY()
+	uint16 Sequence = 0;
+
+	/** Sequence of the acknowledged state these were made against, 0 for the empty set */
+	UPROPERTY()
+	uint16 BaselineSequence = 0;
+
+	/** Graspables whose granted state differs from the baseline */
+	UPROPERTY()
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> Graspables;
+
+	/** One bit per graspable, set if its ability is granted */
+	UPROPERTY()
+	TArray<uint8> GrantedBits;
+
+	void Add(const UPrimitiveComponent* Graspable, bool bGranted);
+
+	int32 Num() const { return Graspables.Num(); }
+
+	bool IsGranted(int32 Index) const
+	{
+		return GrantedBits.IsValidIndex(Index >> 3) && (GrantedBits[Index >> 3] & (1 << (Index & 7))) != 0;
+	}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGraspMirrorCorrections> : public TStructOpsTypeTraitsBase2<FGraspMirrorCorrections>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Local scan result projected to the screen, ranked for choosing which interaction prompt to show
+ */
+USTRUCT(BlueprintType)
+struct GRASP_API FGraspScreenCandidate
+{
+	GENERATED_BODY()
+
+	FGraspScreenCandidate()
+		: GraspDataIndex(0)
+		, QueryResult(EGraspQueryResult::None)
+		, ScreenPosition(FVector2D::ZeroVector)
+		, Score(0.f)
+	{}
+
+	/** The graspable component */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	TWeakObjectPtr<UPrimitiveComponent> Graspable;
+
+	/** Index of the GraspData on the graspable component */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	int32 GraspDataIndex;
+
+	/** Whether we can highlight or interact with the graspable */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	EGraspQueryResult QueryResult;
+
+	/** Position of the graspable in viewport space, the same space as GetScreenPositionForGraspableComponent */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	FVector2D ScreenPosition;
+
+	/** Ranking score, lower is better */
+	UPROPERTY(BlueprintReadOnly, Category=Grasp)
+	float Score;
+};
+
+/**
+ * Plain copy of the UGraspData range parameters used by interaction checks
+ * Has no UObject references, so it can be stored in fragments and evaluated off the game thread
+ */
+USTRUCT()
+struct GRASP_API FGraspInteractParams
+{
+	GENERATED_BODY()
+
+	FGraspInteractParams()
+		: MaxGraspAngle(360.f)
+		, MaxGraspDistance(200.f)
+		, MaxHighlightDistance(400.f)
+		, MaxHeightAbove(30.f)
+		, MaxHeightBelow(30.f)
+		, bGraspDistance2D(false)
+	{}
+
+	/**
+	 * Copy the range parameters from GraspData
+	 * @param bApplyAuthNetTolerance If true, scale by the GraspData's AuthNetTolerance, as UGraspStatics::CanInteractWith does on server authority
+	 */
+	static FGraspInteractParams Make(const UGraspData* GraspData, bool bApplyAuthNetTolerance = false);
+
+	UPROPERTY()
+	float MaxGraspAngle;
+
+	UPROPERTY()
+	float MaxGraspDistance;
+
+	UPROPERTY()
+	float MaxHighlightDistance;
+
+	UPROPERTY()
+	float MaxHeightAbove;
+
+	UPROPERTY()
+	float MaxHeightBelow;
+
+	UPROPERTY()
+	bool bGraspDistance2D;
+};
+
 DECLARE_DELEGATE_TwoParams(FOnGraspTargetsReady, UGraspComponent* GraspComponent, const TArray<FGraspScanResult>& Results);
@@ -82,6 +82,19 @@ if (GraspData_DEPRECATED) \
 }
 #endif
 
+// Register with the UGraspSubsystem graspable index while the component is registered
+#define GRASP_REGISTER_GRASPABLE_COMPONENT() \
+virtual void OnRegister() override \
+{ \
+	Super::OnRegister(); \
+	UGraspSubsystem::RegisterGraspable(this); \
+} \
+virtual void OnUnregister() override \
+{ \
+	UGraspSubsystem::UnregisterGraspable(this); \
+	Super::OnUnregister(); \
+}
+
 // Inheritance band-aid...
 #define APPLY_GRASP_DEFAULT_COLLISION_SETTINGS(BodyInstance, GetNameFunc) \
 if (const UGraspDeveloper* GraspDeveloper = GetDefault<UGraspDeveloper>()) \
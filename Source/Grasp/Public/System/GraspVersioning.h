@@ -28,4 +28,12 @@
 #else
 #define UE_5_05_OR_LATER 0
 #endif
+#endif
+
+#ifndef UE_5_06_OR_LATER
+#if !UE_VERSION_OLDER_THAN(5, 6, 0)
+#define UE_5_06_OR_LATER 1
+#else
+#define UE_5_06_OR_LATER 0
+#endif
 #endif
\ No newline at end of file
@@ -5,8 +5,27 @@
 #include "CoreMinimal.h"
 #include "GraspTargetingTypes.h"
 #include "Tasks/TargetingSelectionTask_AOE.h"
+#include "Types/TargetingSystemTypes.h"
 #include "GraspTargetSelection.generated.h"
 
+/**
+ * State UGraspTargetSelection keeps for each targeting request handle, released with the handle
+ * Kept per request rather than on the task, so scans that share a source (e.g. a listen server's scan and local scan)
+ * don't overwrite each other
+ */
+struct GRASP_API FGraspTargetSelectionState
+{
+	DECLARE_TARGETING_DATA_STORE(FGraspTargetSelectionState)
+
+	/** Source actor of the request's last scan */
+	TObjectKey<AActor> Source;
+
+	/** Source location of the request's last scan, used by bSweepFromLastLocation */
+	FVector LastSourceLocation = FVector::ZeroVector;
+
+	bool bHasLastSourceLocation = false;
+};
+
 /**
  * Extend targeting for interaction selection
  * Adds location and rotation sources
@@ -29,6 +48,16 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Grasp Selection")
 	TArray<TEnumAsByte<EObjectTypeQuery>> CollisionObjectTypes;
 
+	/**
+	 * Find candidates from the UGraspSubsystem graspable index using their cached bounds, then test them against the
+	 * shape analytically instead of running a physics query
+	 * Only finds graspables registered with the index, and tests their bounding spheres rather than their collision
+	 * Requires CollisionObjectTypes to contain only the GraspDefaultObjectType, as the index can't filter by channel,
+	 * profile or other object types; falls back to a physics overlap otherwise, or if the subsystem is unavailable
+	 */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection")
+	bool bUseGraspableIndex = false;
+
 	/** Location to trace from */
 	UPROPERTY(EditAnywhere, Category="Grasp Selection")
 	EGraspTargetLocationSource LocationSource;
@@ -91,6 +120,36 @@ protected:
 	 */
 	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1", Delta="0.05", ForceUnits="Percent", EditCondition="MovementSelectionMode!=EGraspMovementSelectionMode::Disabled", EditConditionHides))
 	float MovementSelectionAccelBias;
+
+	/**
+	 * Sweep the shape from the source location of the last scan to the current one, instead of overlapping in place
+	 * Fast moving pawns can scan at a lower rate without passing graspables between scans
+	 * The last location is stored on the targeting request handle, so this requires handles that are reused between scans
+	 * Requires CollisionObjectTypes, sweeps by profile or channel stop at the first blocking hit so overlap in place instead
+	 * @see p.Grasp.Scan.ReuseTargetingHandles
+	 */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape")
+	bool bSweepFromLastLocation = false;
+
+	/** If the source moved further than this since the last scan (e.g. teleported), overlap in place instead of sweeping */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", ForceUnits="cm", EditCondition="bSweepFromLastLocation", EditConditionHides))
+	float MaxSweepDistance = 1000.f;
+
+	/**
+	 * Offset the shape along the pawn's predicted motion, extrapolating velocity and acceleration this far ahead
+	 * Graspables the pawn is heading toward are found before it arrives, allowing a smaller shape
+	 * 0 to disable
+	 */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	float PredictionTime = 0.f;
+
+	/** Maximum distance the shape can be offset by PredictionTime */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", ForceUnits="cm", EditCondition="PredictionTime>0", EditConditionHides))
+	float MaxPredictionDistance = 300.f;
+
+	/** If true, the predicted offset ignores vertical motion */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(EditCondition="PredictionTime>0", EditConditionHides))
+	bool bPredictAlongGround = true;
 	
 	/** The half extent to use for box and cylinder */
 	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(EditCondition="ShapeType==EGraspTargetingShape::Box||ShapeType==EGraspTargetingShape::Cylinder", EditConditionHides))
@@ -158,6 +217,12 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category="Grasp Selection")
 	FVector GetSourceOffset(const FTargetingRequestHandle& TargetingHandle) const;
 
+	/** Offset along the pawn's predicted motion, see PredictionTime */
+	virtual FVector GetPredictionOffset(const FTargetingRequestHandle& TargetingHandle) const;
+
+	/** Location the shape is placed at, the source location with its offset and predicted motion */
+	FVector GetQueryLocation(const FTargetingRequestHandle& TargetingHandle) const;
+
 	/** Native event to get the source rotation for the AOE  */
 	UFUNCTION(BlueprintNativeEvent, Category="Grasp Selection")
 	FQuat GetSourceRotation(const FTargetingRequestHandle& TargetingHandle) const;
@@ -188,6 +253,22 @@ public:
 	virtual void Execute(const FTargetingRequestHandle& TargetingHandle) const override;
 
 protected:
+	/** @return True if the collision settings only select what the graspable index contains */
+	bool CanUseGraspableIndex() const;
+
+	/** Warn if bUseGraspableIndex or bSweepFromLastLocation are set with collision settings they can't honor */
+	void ValidateCollisionSettings() const;
+
+	/**
+	 * Find candidates in the graspable index and test their bounds against the shape, completing immediately
+	 * @return False if the graspable index is unavailable and a physics query should be used instead
+	 */
+	bool ExecuteIndexQuery(const FTargetingRequestHandle& TargetingHandle) const;
+
+	/** @return True if the sphere overlaps the shape placed at ShapeLocation */
+	bool DoesShapeOverlapSphere(const FCollisionShape& CollisionShape, const FVector& ShapeLocation,
+		const FQuat& ShapeRotation, const FVector& SphereCenter, float SphereRadius) const;
+
 	/** Method to process the trace task immediately */
 	void ExecuteImmediateTrace(const FTargetingRequestHandle& TargetingHandle) const;
 
@@ -198,11 +279,31 @@ protected:
 	void HandleAsyncOverlapComplete(const FTraceHandle& InTraceHandle, FOverlapDatum& InOverlapDatum,
 		FTargetingRequestHandle TargetingHandle) const;
 
+	/** Callback for an async sweep */
+	void HandleAsyncSweepComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum,
+		FTargetingRequestHandle TargetingHandle) const;
+
+	/**
+	 * Get the location to sweep from, and record the source location for the next scan
+	 * @return True if the shape should be swept from OutSweepStart instead of overlapped in place
+	 */
+	bool GetSweepStart(const FTargetingRequestHandle& TargetingHandle, const FVector& SourceLocation, FVector& OutSweepStart) const;
+
+	/** Convert sweep hits to overlap results so they are processed the same way */
+	static void ConvertSweepHits(const TArray<FHitResult>& Hits, TArray<FOverlapResult>& OutOverlaps);
+
 	/**
 	 * Method to take the overlap results and store them in the targeting result data
+	 * @param SweepStart If the results came from a sweep, the location it started from
 	 * @return Num valid results
 	 */
-	int32 ProcessOverlapResults(const FTargetingRequestHandle& TargetingHandle, const TArray<FOverlapResult>& Overlaps) const;
+	int32 ProcessOverlapResults(const FTargetingRequestHandle& TargetingHandle, const TArray<FOverlapResult>& Overlaps,
+		const FVector* SweepStart = nullptr) const;
+
+	/** Scratch buffers for overlaps and sweeps processed on the game thread, keep their capacity between requests */
+	mutable TArray<FOverlapResult> OverlapResultsScratch;
+	mutable TArray<FHitResult> SweepHitsScratch;
+	mutable TArray<UPrimitiveComponent*> IndexCandidatesScratch;
 	
 protected:
 	/** Helper method to build the Collision Shape */
@@ -33,7 +33,7 @@ public:
 	/** Native event to get the source rotation for the AOE  */
 	UFUNCTION(BlueprintCallable, Category=Grasp)
 	static FQuat GetSourceRotation(const FTargetingRequestHandle& TargetingHandle,
-		EGraspTargetRotationSource RotationSource, TArray<EGraspTargetRotationSource> FallbackRotationSources,
+		EGraspTargetRotationSource RotationSource, const TArray<EGraspTargetRotationSource>& FallbackRotationSources,
 		int32 FallbackIndex = 0);
 
 	/** Setup CollisionQueryParams for the AOE */
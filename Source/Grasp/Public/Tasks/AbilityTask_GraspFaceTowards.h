@@ -9,6 +9,50 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FApplyFaceTowardsDelegate);
 
 class UCharacterMovementComponent;
+struct FRootMotionSource_GraspFaceTowards;
+
+/**
+ * Face towards parameters, replicated as a single packed struct
+ * When quantized, flags share a byte, 2D directions are sent as a 16-bit yaw and duration in milliseconds
+ * @see p.Grasp.FaceTowards.QuantizeNetSerialize
+ */
+USTRUCT()
+struct GRASP_API FGraspFaceTowardsParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector WorldLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector WorldDirection = FVector::ZeroVector;
+
+	UPROPERTY()
+	float Duration = 0.2f;
+
+	UPROPERTY()
+	bool bFace2D = true;
+
+	UPROPERTY()
+	bool bEnableGravity = false;
+
+	UPROPERTY()
+	bool bStopWhenAbilityEnds = false;
+
+	UPROPERTY()
+	bool bTickless = false;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGraspFaceTowardsParams> : public TStructOpsTypeTraitsBase2<FGraspFaceTowardsParams>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
 
 /**
  * Face towards a target over time using a root motion source
@@ -39,6 +83,7 @@ public:
 	 * @param bFace2D If true, normalize the face direction to 2D space
 	 * @param bEnableGravity If false, gravity will be ignored while the task is active
 	 * @param bStopWhenAbilityEnds If true, the impulse will stop when the ability ends
+	 * @param bTickless If true, the task doesn't tick and instead completes from a timer once the duration has elapsed
 	 */
 	static UAbilityTask_GraspFaceTowards* FaceTowards
 	(
@@ -50,7 +95,8 @@ public:
 		float Duration = 0.2f,
 		bool bFace2D = true,
 		bool bEnableGravity = true,
-		bool bStopWhenAbilityEnds = false
+		bool bStopWhenAbilityEnds = false,
+		bool bTickless = false
 	);
 
 	/**
@@ -64,6 +110,7 @@ public:
 	 * @param bFace2D If true, normalize the face direction to 2D space
 	 * @param bEnableGravity If false, gravity will be ignored while the task is active
 	 * @param bStopWhenAbilityEnds If true, the impulse will stop when the ability ends
+	 * @param bTickless If true, the task doesn't tick and instead completes from a timer once the duration has elapsed
 	 */
 	UFUNCTION(BlueprintCallable, Category="Ability|Tasks", meta=(DisplayName="Face Towards (Grasp)", Keywords="rotate,grasp", HidePin="OwningAbility", DefaultToSelf="OwningAbility", BlueprintInternalUseOnly="TRUE"))
 	static UAbilityTask_GraspFaceTowards* K2_FaceTowards
@@ -76,7 +123,8 @@ public:
 		float Duration = 0.2f,
 		bool bFace2D = true,
 		bool bEnableGravity = true,
-		bool bStopWhenAbilityEnds = false
+		bool bStopWhenAbilityEnds = false,
+		bool bTickless = false
 	);
 
 	virtual void InitSimulatedTask(UGameplayTasksComponent& InGameplayTasksComponent) override;
@@ -85,6 +133,18 @@ public:
 	virtual void TickTask(float DeltaTime) override;
 	bool HasTimedOut() const;
 
+protected:
+	/** Complete the task once the root motion source has finished */
+	void FinishFaceTowards();
+
+	/** Tickless completion, waits a frame at a time if the root motion source hasn't finished yet */
+	void OnTicklessTimer();
+
+	/** @return A root motion source from the world's pool, see UGraspSubsystem::AcquireFaceTowardsRootMotionSource() */
+	TSharedPtr<FRootMotionSource_GraspFaceTowards> AcquireRootMotionSource() const;
+
+public:
+
 	virtual void PreDestroyFromReplication() override;
 	virtual void OnDestroy(bool bInOwnerFinished) override;
 	
@@ -96,22 +156,9 @@ protected:
 	TObjectPtr<const USceneComponent> TargetComponent;
 	
 	UPROPERTY(Replicated)
-	FVector WorldLocation;
-	
-	UPROPERTY(Replicated)
-	FVector WorldDirection;
-	
-	UPROPERTY(Replicated)
-	bool bFace2D;
-	
-	UPROPERTY(Replicated)
-	float Duration;
+	FGraspFaceTowardsParams Params;
 
-	UPROPERTY(Replicated)
-	bool bEnableGravity;
-	
-	UPROPERTY(Replicated)
-	bool bStopWhenAbilityEnds;
+	FTimerHandle TicklessTimer;
 	
 	UPROPERTY()
 	TObjectPtr<UCharacterMovementComponent> MovementComponent; 
@@ -23,6 +23,18 @@ struct GRASP_API FRootMotionSource_GraspFaceTowards : public FRootMotionSource
 	
 	UPROPERTY()
 	FVector TargetDirection;
+
+protected:
+	/** Orientations of StartDirection and TargetDirection, built once instead of every movement tick */
+	FQuat StartQuat;
+	FQuat TargetQuat;
+	bool bQuatsCached;
+
+	void CacheQuats();
+
+public:
+	/** Call after changing StartDirection or TargetDirection once the source has been prepared */
+	void InvalidateCachedQuats() { bQuatsCached = false; }
 	
 	virtual FRootMotionSource* Clone() const override;
 
@@ -37,6 +49,15 @@ struct GRASP_API FRootMotionSource_GraspFaceTowards : public FRootMotionSource
 
 	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
+	/** @return True if face towards replication should be quantized, see p.Grasp.FaceTowards.QuantizeNetSerialize */
+	static bool ShouldQuantizeNetSerialize();
+
+	/**
+	 * Serialize a unit direction, 2D directions as a 16-bit yaw, otherwise with 16 bits per component
+	 * @return False if the direction failed to serialize
+	 */
+	static bool SerializeQuantizedDirection(FArchive& Ar, FVector& Direction, bool b2D);
+
 	virtual UScriptStruct* GetScriptStruct() const override
 	{
 		return StaticStruct();
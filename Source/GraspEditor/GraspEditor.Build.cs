@@ -20,6 +20,7 @@ public class GraspEditor : ModuleRules
             {
                 "CoreUObject",
                 "Engine",
+                "AssetRegistry",
                 "Grasp",
             }
         );
@@ -0,0 +1,162 @@
+// Copyright (c) Jared Taylor
+
+#include "GraspBakeIndexCommandlet.h"
+#include "GraspableComponent.h"
+#include "GraspLevelIndex.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspBakeIndexCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogGraspBakeIndex, Log, All);
+
+UGraspBakeIndexCommandlet::UGraspBakeIndexCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UGraspBakeIndexCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamVals;
+	ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+	const bool bDryRun = Switches.Contains(TEXT("DryRun"));
+
+	// Gather the maps to bake, either from -Maps or every map under -Path
+	TArray<FString> PackageNames;
+	if (const FString* Maps = ParamVals.Find(TEXT("Maps")))
+	{
+		Maps->ParseIntoArray(PackageNames, TEXT("+"));
+	}
+	else
+	{
+		const FString* Path = ParamVals.Find(TEXT("Path"));
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+		Filter.PackagePaths.Add(FName(Path ? **Path : TEXT("/Game")));
+		Filter.bRecursivePaths = true;
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssets(Filter, Assets);
+		for (const FAssetData& Asset : Assets)
+		{
+			PackageNames.Add(Asset.PackageName.ToString());
+		}
+	}
+
+	int32 NumFailed = 0;
+	for (const FString& PackageName : PackageNames)
+	{
+		UPackage* Package = LoadPackage(nullptr, *PackageName, LOAD_None);
+		UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+		if (!World || !World->PersistentLevel)
+		{
+			UE_LOG(LogGraspBakeIndex, Error, TEXT("Failed to load map %s"), *PackageName);
+			NumFailed++;
+			continue;
+		}
+
+		if (World->PersistentLevel->bIsPartitioned)
+		{
+			UE_LOG(LogGraspBakeIndex, Display, TEXT("Skipping World Partition map %s"), *PackageName);
+			continue;
+		}
+
+		const int32 NumBaked = BakeLevel(World->PersistentLevel);
+		if (NumBaked == INDEX_NONE)
+		{
+			NumFailed++;
+			continue;
+		}
+
+		UE_LOG(LogGraspBakeIndex, Display, TEXT("Baked %d graspables into %s"), NumBaked, *PackageName);
+
+		if (!bDryRun)
+		{
+			Package->MarkPackageDirty();
+
+			FSavePackageArgs SaveArgs;
+			SaveArgs.TopLevelFlags = RF_Standalone;
+			const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetMapPackageExtension());
+			if (!UPackage::SavePackage(Package, World, *Filename, SaveArgs))
+			{
+				UE_LOG(LogGraspBakeIndex, Error, TEXT("Failed to save %s, is it writable?"), *Filename);
+				NumFailed++;
+			}
+		}
+	}
+
+	return NumFailed > 0 ? 1 : 0;
+}
+
+int32 UGraspBakeIndexCommandlet::BakeLevel(ULevel* Level)
+{
+	if (!Level)
+	{
+		return INDEX_NONE;
+	}
+
+	Level->RemoveUserDataOfClass(UGraspLevelIndex::StaticClass());
+
+	UGraspLevelIndex* Index = NewObject<UGraspLevelIndex>(Level);
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (!IsValid(Actor))
+		{
+			continue;
+		}
+
+		// Components aren't registered in a commandlet, make sure their transforms are up to date
+		if (USceneComponent* RootComponent = Actor->GetRootComponent())
+		{
+			RootComponent->UpdateComponentToWorld();
+		}
+
+		TInlineComponentArray<UPrimitiveComponent*> Components(Actor);
+		for (UPrimitiveComponent* Component : Components)
+		{
+			if (!Cast<IGraspableComponent>(Component) || Component->IsEditorOnly())
+			{
+				continue;
+			}
+
+			// Anything that can move registers with UGraspSubsystem at runtime instead
+			if (Component->Mobility != EComponentMobility::Static)
+			{
+				continue;
+			}
+
+			const FBoxSphereBounds Bounds = Component->CalcBounds(Component->GetComponentTransform());
+
+			FGraspBakedEntry& Entry = Index->Entries.AddDefaulted_GetRef();
+			Entry.BoundsOrigin = FVector3f(Bounds.Origin);
+			Entry.BoundsRadius = Bounds.SphereRadius;
+
+			Index->ActorNames.Add(Actor->GetFName());
+			Index->ComponentNames.Add(Component->GetFName());
+		}
+	}
+
+	if (Index->Num() > 0)
+	{
+		Level->AddAssetUserData(Index);
+	}
+
+	return Index->Num();
+}
@@ -0,0 +1,31 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GraspBakeIndexCommandlet.generated.h"
+
+/**
+ * Bakes a UGraspLevelIndex into each map for graspables placed with Static mobility
+ * UGraspSubsystem attaches the baked index when the level is added, instead of registering each component
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=GraspBakeIndex [-Maps=/Game/Maps/A+/Game/Maps/B] [-Path=/Game] [-DryRun]
+ * Maps are saved in place and must be writable; World Partition maps are skipped, their cells register at runtime
+ */
+UCLASS()
+class GRASPEDITOR_API UGraspBakeIndexCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGraspBakeIndexCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	/**
+	 * Build the graspable index for a level and store it as asset user data, replacing any existing index
+	 * @return Number of graspables baked, or INDEX_NONE if the level could not be baked
+	 */
+	static int32 BakeLevel(ULevel* Level);
+};